@@ -0,0 +1,47 @@
+/**
+ * @file benchmark.h
+ * @brief Header file providing the engine throughput benchmark suite.
+ *
+ * The suite measures the move engines and the win checks on fixed position sets and writes the results
+ * as JSON. It runs unchanged on the host ('Tools/benchSuite.c') and on the target, where it is started
+ * from 'main()' when the firmware is built with ENGINE_BENCHMARK defined and times with the DWT cycle
+ * counter, so the firmware's engine speed can be tracked across releases.
+ */
+#pragma once
+#ifndef SRC_BENCHMARK_H_
+#define SRC_BENCHMARK_H_
+
+/**
+ * @brief Node budget of the fixed-budget runs.
+ */
+#ifndef BENCHMARK_NODE_BUDGET
+#define BENCHMARK_NODE_BUDGET 2000
+#endif
+
+/**
+ * @brief Number of times the win checks are repeated on every position set.
+ */
+#ifndef BENCHMARK_CHECK_ROUNDS
+#define BENCHMARK_CHECK_ROUNDS 1000
+#endif
+
+/**
+ * @brief Receives the JSON output of the benchmark, piece by piece.
+ */
+typedef void (*BenchmarkWriter)(const char *text);
+
+/**
+ * @brief Runs the whole benchmark suite and writes the results as one JSON object.
+ *
+ * Every registered engine chooses a move on every position of every set it supports, once at a fixed
+ * depth and once with a fixed node budget ('BENCHMARK_NODE_BUDGET'), and 'checkWin()' is timed against
+ * 'checkWinScalar()'. The output is a single JSON document, not JSON Lines: an object with the fields
+ * 'clock', 'tickHz' and 'nodeBudget' and a 'results' array of one object per result. Every element of
+ * the array is written on a line of its own, so the output can also be compared line by line. Times are
+ * measured in clock ticks: CPU cycles on the target, nanoseconds on the host.
+ *
+ * @param write Receives the output.
+ */
+void BenchmarkRun(BenchmarkWriter write);
+
+#endif /* SRC_BENCHMARK_H_ */
@@ -4,28 +4,69 @@
  *
  * This file contains the declaration of the 'drawField' function, which is responsible
  * for rendering the game field on the screen. The function handles the display of the game
- * grid with the current state of the game, including the active cell and support for inverting
- * the display theme if needed.
+ * grid with the current state of the game, including the active cell, an optional heat map of
+ * move scores and hint, and support for inverting the colors of the field if needed.
  */
 #ifndef SRC_DRAWFIELD_H_
 #define SRC_DRAWFIELD_H_
 
 #pragma once
 
+#include <stddef.h>
+
+/**
+ * @brief Number of grid images cached by 'drawField()'.
+ *
+ * Each slot holds one screenbuffer (1 KB) for a field size and color scheme. Two slots keep the grid of the
+ * game and of the inverted result screen for the selected field size.
+ */
+#ifndef gridCacheSlots
+#define gridCacheSlots 2
+#endif
+
+/**
+ * @brief Memory and use of the grid cache.
+ */
+typedef struct {
+	size_t bytes; /**< Static memory of the cache */
+	int slots; /**< Number of images the cache holds */
+	unsigned long hits; /**< Number of grids copied from the cache */
+	unsigned long misses; /**< Number of grids drawn and saved in the cache */
+} GridCacheStats;
+
 /**
  * @brief Draws the game field on the screen.
  *
  * This function updates the display to show the current state of the game field, including the 
- * positions of 'X' and 'O' characters, the active cell, and optionally inverts the display theme 
- * depending on the game settings.
+ * positions of 'X' and 'O' characters, the active cell, and optionally inverts the colors of the field.
+ * It always draws the dark theme; the light theme is shown by inverting the display. Only the cells that changed since the last call are redrawn, unless
+ * the field size or the colors changed or 'BoardViewInvalidate()' was called.
  *
  * @param field A 2D array representing the game board, where each element is a character ('x', 'o', or empty space).
  * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
  * @param activeCellX The X-coordinate of the currently active cell that the user is interacting with.
  * @param activeCellY The Y-coordinate of the currently active cell that the user is interacting with.
  * @param invert A flag to indicate whether the display should be inverted (for accessibility or design purposes).
- * @param invertThemeFlag A flag indicating if the theme of the game should be dark or light.
+ * @param heatMap The score of a move on every cell, as returned by 'AnalyseMoves()', or NULL for no heat map.
+ *                Empty cells are shaded from none (worst move) to dense (best move).
+ * @param hintCellX The X-coordinate of the cell suggested by the hint engine, or -1 for no hint.
+ * @param hintCellY The Y-coordinate of the cell suggested by the hint engine, or -1 for no hint.
+ */
+void drawField(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert,
+		int heatMap[maxFieldSize][maxFieldSize], int hintCellX, int hintCellY);
+
+/**
+ * @brief Forgets the field retained by 'drawField()', so the next call redraws the whole screen.
+ *
+ * Call this whenever the screen is drawn over by anything but 'drawField()' and the texts drawn on the field.
+ */
+void BoardViewInvalidate(void);
+
+/**
+ * @brief Writes the memory and the hit counts of the grid cache.
+ *
+ * @param stats Receives the statistics.
  */
-void drawField(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert, bool invertThemeFlag);
+void GridCacheGetStats(GridCacheStats *stats);
 
 #endif
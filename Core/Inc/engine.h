@@ -0,0 +1,124 @@
+/**
+ * @file engine.h
+ * @brief Header file providing the interface of the computer's move engines and their registry.
+ *
+ * An engine is a set of functions that choose the computer's move. Every engine supports some board
+ * sizes, and for every board size one engine is selected at runtime, so each size can use the fastest
+ * engine that plays well enough. The game asks for the computer's move through 'EngineMove()'.
+ */
+#pragma once
+#ifndef SRC_ENGINE_H_
+#define SRC_ENGINE_H_
+
+#include <stdbool.h>
+#include "gameConfiguration.h"
+
+#define engineSize(size) (1u << (size)) /**< Bit of a board size in 'Engine.sizes' */
+
+/**
+ * @brief Limits of a single move search.
+ *
+ * A zero field means the engine's default. Engines that do not search ignore the budget.
+ */
+typedef struct {
+	int maxDepth; /**< Maximum search depth in plies */
+	unsigned long maxNodes; /**< Maximum number of search nodes */
+} EngineBudget;
+
+/**
+ * @brief Statistics of the last move chosen by an engine.
+ */
+typedef struct {
+	unsigned long nodes; /**< Number of search nodes, 0 for engines that do not search */
+	int depth; /**< Depth of the deepest completed search, 0 for engines that do not search */
+} EngineStats;
+
+/**
+ * @brief A move engine.
+ *
+ * All functions except 'search' may be NULL if the engine has nothing to do.
+ */
+typedef struct {
+	const char *name; /**< Short unique name of the engine */
+	unsigned sizes; /**< Supported board sizes, a combination of 'engineSize()' bits */
+	void (*init)(void); /**< Prepares the engine when it is selected for a board size */
+	void (*newGame)(int size); /**< Forgets everything about the previous game */
+	/**
+	 * Chooses the computer's move on a board with the computer ('o') to move, without changing the board.
+	 * Returns false if the engine found no move.
+	 */
+	bool (*search)(char board[maxFieldSize][maxFieldSize], int size, const EngineBudget *budget, int *row,
+			int *column);
+	void (*stats)(EngineStats *stats); /**< Writes the statistics of the last chosen move */
+	void (*release)(void); /**< Frees the engine's resources when it is no longer selected for any size */
+} Engine;
+
+extern const Engine minimaxEngine; /**< Alpha-beta search with a proof-number check for forced wins */
+extern const Engine tableEngine; /**< Perfect play on 3x3 by table lookup */
+
+/**
+ * @brief Returns the number of registered engines.
+ *
+ * @return The number of engines.
+ */
+int EngineCount(void);
+
+/**
+ * @brief Returns a registered engine.
+ *
+ * @param index The index of the engine, from 0 to 'EngineCount()' - 1.
+ * @return The engine.
+ */
+const Engine* EngineAt(int index);
+
+/**
+ * @brief Finds a registered engine by its name.
+ *
+ * @param name The name of the engine.
+ * @return The engine, or NULL if there is no engine with that name.
+ */
+const Engine* EngineFind(const char *name);
+
+/**
+ * @brief Selects the engine used for a board size.
+ *
+ * The new engine is initialised, and the old one is released if no other size uses it anymore.
+ *
+ * @param size The size of the game board.
+ * @param engine The engine to use.
+ * @return True if the engine was selected, false if it does not support the board size.
+ */
+bool EngineSelect(int size, const Engine *engine);
+
+/**
+ * @brief Returns the engine used for a board size.
+ *
+ * By default, 3x3 uses the table engine and the larger boards use the Minimax engine.
+ *
+ * @param size The size of the game board.
+ * @return The selected engine.
+ */
+const Engine* EngineSelected(int size);
+
+/**
+ * @brief Initialises the engines selected by default. Must be called once at startup.
+ */
+void EngineInit(void);
+
+/**
+ * @brief Tells the engine of a board size that a new game starts.
+ *
+ * @param size The size of the game board.
+ */
+void EngineNewGame(int size);
+
+/**
+ * @brief Makes the computer's move with the engine selected for the board size and its default budget.
+ *
+ * @param board The current game board, with the computer to move.
+ * @param size The size of the game board.
+ * @return True if a move was made, false otherwise.
+ */
+bool EngineMove(char board[maxFieldSize][maxFieldSize], int size);
+
+#endif /* SRC_ENGINE_H_ */
@@ -0,0 +1,25 @@
+/**
+ * @file evalWeights.h
+ * @brief Weights of the horizon evaluation, read by 'Tools/genEvalTables.c'.
+ *
+ * This file is generated by Tools/texelTune.c from self-play data. Do not edit it by hand; to change
+ * the weights, tune them again and regenerate 'Core/Src/evalTables.c' with 'Tools/genEvalTables.c'.
+ *
+ * Tuned with '-g 0.001': line lengths whose tuned weights lowered the mean squared error by less
+ * than 0.001 kept their previous weights.
+ */
+#pragma once
+#ifndef SRC_EVALWEIGHTS_H_
+#define SRC_EVALWEIGHTS_H_
+
+/**
+ * @brief Score of a window holding 'count' pieces of only one player, indexed [toWin][count].
+ *
+ * A full window is a finished game and is never evaluated, so its weight is unused.
+ */
+#define LINE_WEIGHTS { \
+	[3] = { 0, 1, 10, 0 }, \
+	[4] = { 0, 1, 5, 25, 0 }, \
+}
+
+#endif /* SRC_EVALWEIGHTS_H_ */
@@ -0,0 +1,66 @@
+/**
+ * @file evaluation.h
+ * @brief Header file providing the static evaluation used at the search horizon.
+ *
+ * This file contains the declaration of the table-driven board evaluation. Every winning line
+ * ("window") of the board is encoded as a small base-3 number and looked up in a precomputed score table.
+ * The tables are generated by 'Tools/genEvalTables.c' for every board size and are stored in flash.
+ */
+#pragma once
+#ifndef SRC_EVALUATION_H_
+#define SRC_EVALUATION_H_
+
+#include <stdint.h>
+#include "gameConfiguration.h"
+
+/**
+ * @brief Pattern tables of one board size.
+ *
+ * 'windowCells' holds 'windowCount' groups of 'toWin' cell indices (row * maxFieldSize + column).
+ * The windows passing through cell c are 'cellWindows[cellWindowStart[c]]' up to, but excluding,
+ * 'cellWindows[cellWindowStart[c + 1]]'.
+ * 'scores' is indexed by the base-3 encoding of a window: the cell at position k contributes
+ * 3^k times 0 (empty), 1 (computer) or 2 (player). 'threats' uses the same index; its low nibble is
+ * the position of the empty cell plus one if the window is a computer threat ('toWin - 1' computer
+ * pieces and one empty cell), its high nibble the same for a player threat.
+ */
+typedef struct {
+	uint8_t size;
+	uint8_t toWin;
+	uint8_t windowCount;
+	const uint8_t *windowCells;
+	const uint8_t *cellWindowStart;
+	const uint8_t *cellWindows;
+	const int16_t *scores;
+	const uint8_t *threats;
+} EvalMode;
+
+/**
+ * @brief Pattern tables for board sizes 3x3 up to 'maxFieldSize', indexed by 'size - 3'.
+ */
+extern const EvalMode evalModes[maxFieldSize - 2];
+
+/**
+ * @brief Evaluates a board that is not yet decided.
+ *
+ * The score is the sum of the table scores of all windows. Lines that only the computer can still
+ * complete add to the score, lines that only the player can still complete subtract from it.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @return The evaluation from the computer's point of view.
+ */
+int EvaluateBoard(char board[maxFieldSize][maxFieldSize], int size);
+
+/**
+ * @brief Finds the cells where a player would complete a winning line with a single move.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param player The character of the player whose threats are searched.
+ * @param threatCells Receives up to two distinct threat cells (row * maxFieldSize + column).
+ * @return The number of distinct threat cells, capped at 2.
+ */
+int FindThreats(char board[maxFieldSize][maxFieldSize], int size, char player, int threatCells[2]);
+
+#endif /* SRC_EVALUATION_H_ */
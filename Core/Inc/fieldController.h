@@ -13,6 +13,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "gameConfiguration.h"
 
 /**
@@ -29,6 +30,13 @@ extern char field[maxFieldSize][maxFieldSize];
  * to allocate the field array.
  */
 extern int fieldSize;
+/**
+ * @brief Counter that changes every time the game field is cleared or a character is placed.
+ *
+ * It is changed from the UART interrupt, so code running in the main loop can compare it with
+ * an earlier value to notice that the field changed under it.
+ */
+extern volatile uint32_t fieldVersion;
 
 /**
  * @brief Clears the game field by resetting all cells.
@@ -0,0 +1,48 @@
+/**
+ * @file hint.h
+ * @brief Header file providing the background hint engine for the human players.
+ *
+ * This file contains the declarations of the functions that analyse the position on the game field
+ * in the background, one root move per call of the main loop, and cache the result per position.
+ * The result is used to suggest a move (hint) and to draw the move heat map.
+ */
+#pragma once
+#ifndef SRC_HINT_H_
+#define SRC_HINT_H_
+
+#include <stdbool.h>
+#include "gameConfiguration.h"
+
+/**
+ * @brief Number of analysed positions kept in the hint cache.
+ */
+#ifndef HINT_CACHE_SIZE
+#define HINT_CACHE_SIZE 4
+#endif
+
+/**
+ * @brief Advances the background analysis of the position on the game field by one step.
+ *
+ * The function is meant to be called from the idle time of the main loop. If the position is already
+ * in the cache, it does nothing. Otherwise it starts or continues the analysis and searches a single
+ * root move. The analysis is cancelled as soon as 'placeChar()' or 'clearField()' changes the field,
+ * even in the middle of a step, and restarts for the new position on the next call.
+ *
+ * @param toMove The character of the player to move.
+ * @return True if this call finished the analysis of the current position, false otherwise.
+ */
+bool HintStep(char toMove);
+
+/**
+ * @brief Looks up the cached analysis of the position on the game field.
+ *
+ * @param toMove The character of the player to move.
+ * @param scores Receives the score of every cell as reported by 'AnalyseMoves()', indexed like 'field'.
+ *        May be NULL.
+ * @param hintX Receives the X-coordinate (column) of the suggested move.
+ * @param hintY Receives the Y-coordinate (row) of the suggested move.
+ * @return True if the position has been analysed, false if its analysis is not finished yet.
+ */
+bool HintLookup(char toMove, int scores[maxFieldSize][maxFieldSize], int *hintX, int *hintY);
+
+#endif /* SRC_HINT_H_ */
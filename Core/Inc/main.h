@@ -70,6 +70,12 @@ void Error_Handler(void);
 #define TCK_GPIO_Port GPIOA
 #define SWO_Pin GPIO_PIN_3
 #define SWO_GPIO_Port GPIOB
+#define OLED_RESET_Pin GPIO_PIN_9
+#define OLED_RESET_GPIO_Port GPIOA
+#define OLED_CS_Pin GPIO_PIN_6
+#define OLED_CS_GPIO_Port GPIOB
+#define OLED_DC_Pin GPIO_PIN_7
+#define OLED_DC_GPIO_Port GPIOC
 
 /* USER CODE BEGIN Private defines */
 #define SX1509_I2C_PORT       hi2c1
@@ -10,18 +10,166 @@
 #ifndef SRC_MINIMAX_H_
 #define SRC_MINIMAX_H_
 
+#include <stdbool.h>
+#include <stdint.h>
 #include "gameConfiguration.h"
 
+/**
+ * @brief Number of threat extensions allowed in one search, shared by all root moves.
+ *
+ * At the search horizon, a forced block of a threat (a line one piece short of a win) is searched
+ * one ply deeper while this budget lasts. The extensions are off by default: on the positions of
+ * 'Tools/searchBench.c' no budget chose more non-losing moves than none, and every budget cost nodes.
+ */
+#ifndef EXTENSION_BUDGET
+#define EXTENSION_BUDGET 0
+#endif
+
+/**
+ * @brief Index in the ordered move list from which moves without a threat are searched shallower.
+ *
+ * The reductions and 'FUTILITY_MARGIN' were tuned against a build without them, with the second-build
+ * option of 'Tools/tournament.c': smaller indexes and margins saved more nodes but lost strength.
+ */
+#ifndef LATE_MOVE_INDEX
+#define LATE_MOVE_INDEX 12
+#endif
+
+/**
+ * @brief Number of plies by which late moves are reduced before a possible re-search at full depth.
+ */
+#ifndef LATE_MOVE_REDUCTION
+#define LATE_MOVE_REDUCTION 2
+#endif
+
+/**
+ * @brief Largest gain in static evaluation expected from a single move that creates no threat.
+ *
+ * One ply above the horizon, quiet moves are skipped when the static evaluation plus this margin
+ * cannot reach the best score found so far.
+ */
+#ifndef FUTILITY_MARGIN
+#define FUTILITY_MARGIN 30
+#endif
+
+/**
+ * @brief Number of entries of the transposition table shared by the root moves. Must be a power of two.
+ */
+#ifndef TT_SIZE
+#define TT_SIZE 2048
+#endif
+
+#define noScore (-32768) /**< Score reported by 'AnalyseMoves()' for an occupied cell */
+
 /**
  * @brief Calculates and performs the best move for the computer player using the minimax algorithm.
  *
  * This function evaluates the game board and uses the minimax algorithm to determine the optimal move
  * for the computer. It modifies the provided board by placing the computer's move at the calculated position.
+ * The game itself selects its engine through 'engine.h'; this function always uses the Minimax engine.
  * 
  * @param board The current game board represented as a 2D array.
  * @param size The size of the game board (e.g., 3x3, 4x4, or 5x5).
  */
 void ComputerMove(char board[maxFieldSize][maxFieldSize], int size);
 
+/**
+ * @brief Retrieves all empty cells of the board in row-major order.
+ *
+ * The search itself takes its moves from an incremental list; this function is used at the root and
+ * by the host tools.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param moves Receives the row and column of every empty cell.
+ * @param moveCount Receives the number of empty cells.
+ */
+void GetAvailableMoves(char board[maxFieldSize][maxFieldSize], int size, int moves[][2], int *moveCount);
+
+/**
+ * @brief Scores every legal move of the side to move (multi-PV analysis).
+ *
+ * All moves are searched with the same depth and pruning as 'ComputerMove()', sharing one transposition
+ * table, so analysing a position costs little more than choosing a move. The proof-number search is not
+ * run, but wins within the search depth score above any other move.
+ *
+ * @param board The current game board. It is not modified.
+ * @param size The size of the game board.
+ * @param toMove The character of the player to move.
+ * @param scores Receives, indexed like 'board', the score of every empty cell from the point of view of
+ *        'toMove' (higher is better), and 'noScore' for every occupied cell.
+ */
+void AnalyseMoves(char board[maxFieldSize][maxFieldSize], int size, char toMove,
+		int scores[maxFieldSize][maxFieldSize]);
+
+/**
+ * @brief States of an incremental analysis.
+ */
+typedef enum {
+	analysisRunning, analysisDone, analysisCancelled,
+} AnalysisStatus;
+
+/**
+ * @brief An analysis of all moves that is computed one root move at a time.
+ *
+ * The analysis works on its own copy of the position, so the game field may change while it runs.
+ * 'maxDepth' and 'nodeLimit' may be changed before the first step. The other fields are private to
+ * 'minimax.c', except 'moves', 'moveCount', 'nodes' and 'scores', which may be read.
+ */
+typedef struct {
+	char board[maxFieldSize][maxFieldSize]; /**< The analysed position, with the pieces swapped so that 'o' moves */
+	int size; /**< The size of the game board */
+	int moves[maxFieldSize * maxFieldSize][2]; /**< The root moves */
+	int moveCount; /**< The number of root moves */
+	int nextMove; /**< Index of the next root move to search */
+	int maxDepth; /**< Search depth of every root move, may be changed before the first step */
+	unsigned long nodeLimit; /**< Number of nodes after which the analysis is cancelled, 0 (default) for no limit */
+	unsigned long nodes; /**< Number of nodes visited so far */
+	int extensionsLeft; /**< Number of threat extensions the remaining root moves may still apply */
+	uint32_t owner; /**< Number of the root search that filled the transposition table */
+	const volatile uint32_t *cancelVersion; /**< Counter whose change cancels the analysis, or NULL */
+	uint32_t version; /**< Value of '*cancelVersion' when the analysis started */
+	int scores[maxFieldSize][maxFieldSize]; /**< Scores as reported by 'AnalyseMoves()' */
+} Analysis;
+
+/**
+ * @brief Starts an incremental analysis of all moves of the side to move.
+ *
+ * The counter 'cancelVersion' is read before the position is copied. If it changes at any later time,
+ * for example because an interrupt changed the game field, the analysis is cancelled within a single
+ * search node, so a copy taken while the field was changing is never completed.
+ *
+ * @param analysis The analysis to start.
+ * @param board The current game board. It is not modified.
+ * @param size The size of the game board.
+ * @param toMove The character of the player to move.
+ * @param cancelVersion A counter that cancels the analysis when it changes, or NULL.
+ */
+void AnalysisStart(Analysis *analysis, char board[maxFieldSize][maxFieldSize], int size, char toMove,
+		const volatile uint32_t *cancelVersion);
+
+/**
+ * @brief Searches the next root move of an incremental analysis.
+ *
+ * A step searches a single root move, so it takes about 1/n of the time of 'AnalyseMoves()' for n moves.
+ * If another search used the transposition table since the last step, the table is cleared first,
+ * so analyses and moves of the computer may interleave.
+ *
+ * @param analysis The analysis to continue.
+ * @return 'analysisDone' once all moves are scored, 'analysisCancelled' if the cancel counter changed
+ *         or the node limit was reached, 'analysisRunning' otherwise.
+ */
+AnalysisStatus AnalysisStep(Analysis *analysis);
+
+/**
+ * @brief Returns the number of nodes visited by the last Minimax search.
+ *
+ * The count covers the last analysis that reached the Minimax search, whether it was run by
+ * 'ComputerMove()', 'AnalyseMoves()' or 'AnalysisStep()', and is meant for benchmarking the search.
+ *
+ * @return The number of visited nodes.
+ */
+unsigned long MinimaxNodeCount(void);
+
 
 #endif /* SRC_MINIMAX_H_ */
@@ -0,0 +1,75 @@
+/**
+ * @file proofNumber.h
+ * @brief Header file providing the proof-number search used for forced-win detection.
+ *
+ * This file contains the declarations of the proof-number search (PNS) engine. It works on the same
+ * board representation as the minimax algorithm and tries to prove, within a bounded pool of tree nodes,
+ * whether the side to move has a forced win, is lost or drawn against best play, or whether the result is unknown.
+ */
+#pragma once
+#ifndef SRC_PROOFNUMBER_H_
+#define SRC_PROOFNUMBER_H_
+
+#include "gameConfiguration.h"
+
+/**
+ * @brief Maximum number of tree nodes a single proof-number search may allocate.
+ *
+ * The node pool is statically allocated, so this value bounds both the RAM used by the search
+ * and the amount of work done before the search gives up with an unknown result. Node indices are
+ * stored in 16 bits, so the pool can hold at most 65535 nodes.
+ */
+#ifndef PN_NODE_POOL_SIZE
+#define PN_NODE_POOL_SIZE 1024
+#endif
+
+/**
+ * @brief Result of a proof-number search.
+ */
+typedef enum {
+	pnUnknown, /**< The node budget was exhausted before the position was solved */
+	pnProvenWin, /**< The side to move has a forced win */
+	pnProvenLoss, /**< The opponent of the side to move has a forced win */
+	pnProvenDraw, /**< Neither player can force a win */
+} PnResult;
+
+/**
+ * @brief Solves the position with proof-number search.
+ *
+ * The function first tries to prove a forced win for the side to move. If that fails, it tries
+ * to prove a forced win for the opponent. When both searches are disproven, the position is a draw.
+ * If the side to move wins, the search is repeated with a ply bound below the win found until no shorter
+ * win is proven, and the first move of the shortest win is stored in 'bestX' and 'bestY'; otherwise both
+ * are set to -1. The win is the shortest one unless the node pool ran out while proving a shorter one.
+ * The board is restored to its original state before returning.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param toMove The character of the player to move ('x' or 'o').
+ * @param bestX Pointer to the row of the winning move.
+ * @param bestY Pointer to the column of the winning move.
+ * @return The result of the search: proven win, loss, draw or unknown.
+ */
+PnResult ProofNumberSolve(char board[maxFieldSize][maxFieldSize], int size, char toMove,
+		int *bestX, int *bestY);
+
+/**
+ * @brief Returns the number of tree nodes allocated by the last 'ProofNumberSolve()'.
+ *
+ * The count covers all searches of the call: the repeated searches for a shorter win and the search
+ * for the opponent's win, each of which allocates at most 'PN_NODE_POOL_SIZE' nodes.
+ *
+ * @return The number of allocated nodes.
+ */
+unsigned long ProofNumberNodeCount(void);
+
+/**
+ * @brief Returns the number of plies to the end of the last proven win.
+ *
+ * The value is only meaningful after 'ProofNumberSolve()' returned 'pnProvenWin' or 'pnProvenLoss'.
+ *
+ * @return Number of plies, counting both players, until the winning line is completed.
+ */
+int ProofNumberWinDepth(void);
+
+#endif /* SRC_PROOFNUMBER_H_ */
@@ -52,9 +52,11 @@ _BEGIN_STD_C
 #ifdef SSD1306_X_OFFSET
 #define SSD1306_X_OFFSET_LOWER (SSD1306_X_OFFSET & 0x0F)
 #define SSD1306_X_OFFSET_UPPER ((SSD1306_X_OFFSET >> 4) & 0x07)
+#define SSD1306_X_OFFSET_COLUMN SSD1306_X_OFFSET
 #else
 #define SSD1306_X_OFFSET_LOWER 0
 #define SSD1306_X_OFFSET_UPPER 0
+#define SSD1306_X_OFFSET_COLUMN 0
 #endif
 
 /* vvv I2C config vvv */
@@ -120,6 +122,9 @@ extern SPI_HandleTypeDef SSD1306_SPI_PORT;
 #define SSD1306_BUFFER_SIZE   SSD1306_WIDTH * SSD1306_HEIGHT / 8
 #endif
 
+// Number of 8 pixel high pages of the display RAM
+#define SSD1306_PAGES           (SSD1306_HEIGHT / 8)
+
 // Enumeration for screen colors
 typedef enum {
     Black = 0x00, // Black color, no pixel
@@ -128,7 +133,8 @@ typedef enum {
 
 typedef enum {
     SSD1306_OK = 0x00,
-    SSD1306_ERR = 0x01  // Generic error.
+    SSD1306_ERR = 0x01,  // Generic error.
+    SSD1306_BUSY = 0x02  // A transfer of ssd1306_UpdateScreenAsync() is still running.
 } SSD1306_Error_t;
 
 // Struct to store transformations
@@ -137,6 +143,7 @@ typedef struct {
     uint16_t CurrentY;
     uint8_t Initialized;
     uint8_t DisplayOn;
+    uint8_t Inverted;
 } SSD1306_t;
 
 typedef struct {
@@ -150,6 +157,7 @@ typedef struct {
 	const uint8_t height;               /**< Font height in pixels */
 	const uint16_t *const data;         /**< Pointer to font data array */
     const uint8_t *const char_width;    /**< Proportional character width in pixels (NULL for monospaced) */
+    const uint8_t *const pages;         /**< Glyphs in display page format from Tools/genPageFonts.c (NULL if not converted) */
 } SSD1306_Font_t;
 
 // Procedure definitions
@@ -182,6 +190,68 @@ SSD1306_Error_t ssd1306_InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint
 
 void ssd1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color);
 
+/**
+ * @brief Start sending the changed parts of the screenbuffer without waiting.
+ *
+ * With SSD1306_USE_DMA, the transfers run by DMA and the bus interrupts,
+ * and ssd1306_UpdateScreenCpltCallback() is called from the interrupt when
+ * they are done. Drawing may go on meanwhile: what it changes is sent by the
+ * next flush. With SSD1306_DOUBLE_BUFFER, the transfers read a front buffer
+ * that drawing does not touch, so the display never shows a half-drawn
+ * frame. On SPI, the OLED stays selected for the whole flush and DC only
+ * changes between the window commands and the data. The blocking procedures
+ * that use the bus wait for the transfer, so they must not be called from an
+ * interrupt that the bus and DMA interrupts cannot preempt. The flush claims
+ * the bus and takes the changes with interrupts masked, so two callers never
+ * start overlapping transfers; one of them gets SSD1306_BUSY. This library
+ * defines HAL_I2C_MemTxCpltCallback() and HAL_I2C_ErrorCallback(), or
+ * HAL_SPI_TxCpltCallback() and HAL_SPI_ErrorCallback(), in this mode.
+ * Without SSD1306_USE_DMA, the screen is updated before returning.
+ *
+ * @return SSD1306_OK if the flush was started, SSD1306_BUSY if the previous
+ *         one is still running.
+ */
+SSD1306_Error_t ssd1306_UpdateScreenAsync(void);
+
+/**
+ * @brief Checks whether ssd1306_UpdateScreenAsync() is still sending.
+ * @return  0: idle.
+ *          1: busy.
+ */
+uint8_t ssd1306_IsBusy(void);
+
+/**
+ * @brief Called when ssd1306_UpdateScreenAsync() has finished.
+ *
+ * The default does nothing; define it to be notified. After SSD1306_ERR, the
+ * next flush resends what was not sent.
+ *
+ * @param status SSD1306_OK or SSD1306_ERR.
+ */
+void ssd1306_UpdateScreenCpltCallback(SSD1306_Error_t status);
+
+/**
+ * @brief Mark a rectangle (include border) as changed.
+ *
+ * Every drawing procedure marks the bytes it changes, and ssd1306_UpdateScreen()
+ * only sends the changed columns of every page. Use this to resend a region,
+ * e.g. after the display RAM was lost. With SSD1306_DOUBLE_BUFFER, the pages
+ * of the region are sent even where they match the last frame sent.
+ *
+ * @param x1 X Coordinate of top left corner
+ * @param y1 Y Coordinate of top left corner
+ * @param x2 X Coordinate of bottom right corner
+ * @param y2 Y Coordinate of bottom right corner
+ */
+void ssd1306_MarkDirty(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+
+/**
+ * @brief Checks whether the screenbuffer has changes that were not sent yet.
+ * @return  0: nothing to send.
+ *          1: ssd1306_UpdateScreen() has data to send.
+ */
+uint8_t ssd1306_IsDirty(void);
+
 /**
  * @brief Sets the contrast of the display.
  * @param[in] value contrast to set.
@@ -203,11 +273,29 @@ void ssd1306_SetDisplayOn(const uint8_t on);
  */
 uint8_t ssd1306_GetDisplayOn();
 
+/**
+ * @brief Shows the screenbuffer with inverted colors, or normally again.
+ *
+ * The controller inverts the image by itself (0xA7/0xA6): the screenbuffer
+ * and the display RAM are unchanged, and nothing has to be redrawn or sent.
+ * @param[in] on 0 for normal colors, any for inverted colors.
+ */
+void ssd1306_SetInvert(const uint8_t on);
+
+/**
+ * @brief Reads the Inverted state.
+ * @return  0: normal colors.
+ *          1: inverted colors.
+ */
+uint8_t ssd1306_GetInvert();
+
 // Low-level procedures
 void ssd1306_Reset(void);
 void ssd1306_WriteCommand(uint8_t byte);
+void ssd1306_WriteCommands(const uint8_t* cmds, size_t n);
 void ssd1306_WriteData(uint8_t* buffer, size_t buff_size);
-SSD1306_Error_t ssd1306_FillBuffer(uint8_t* buf, uint32_t len);
+SSD1306_Error_t ssd1306_FillBuffer(const uint8_t* buf, uint32_t len);
+SSD1306_Error_t ssd1306_ReadBuffer(uint8_t* buf, uint32_t len);
 
 _END_STD_C
 
@@ -26,7 +26,15 @@
 #define SSD1306_I2C_PORT        hi2c1
 #define SSD1306_I2C_ADDR        (0x3C << 1)
 
-// SPI Configuration
+// Send ssd1306_UpdateScreenAsync() by DMA: I2C1_TX on DMA1 channel 6, or
+// SPI1_TX on DMA1 channel 3 with SSD1306_USE_SPI (8-bit frames, 10 MHz)
+#define SSD1306_USE_DMA
+
+// Draw into a back buffer while the DMA sends a front buffer (1 KB more RAM);
+// a flush also sends only the bytes that differ from the front buffer
+#define SSD1306_DOUBLE_BUFFER
+
+// SPI Configuration (the pins are OLED_CS, OLED_DC and OLED_RESET in AKProject.ioc)
 //#define SSD1306_SPI_PORT        hspi1
 //#define SSD1306_CS_Port         GPIOB
 //#define SSD1306_CS_Pin          GPIO_PIN_6
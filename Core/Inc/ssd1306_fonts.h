@@ -5,9 +5,13 @@
 
 #ifdef SSD1306_INCLUDE_FONT_6x8
 extern const SSD1306_Font_t Font_6x8;
+/** Glyphs of Font_6x8 in display page format, generated by Tools/genPageFonts.c */
+extern const uint8_t Font6x8Pages[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_7x10
 extern const SSD1306_Font_t Font_7x10;
+/** Glyphs of Font_7x10 in display page format, generated by Tools/genPageFonts.c */
+extern const uint8_t Font7x10Pages[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_11x18
 extern const SSD1306_Font_t Font_11x18;
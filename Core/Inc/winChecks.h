@@ -12,6 +12,7 @@
 #ifndef SRC_WINCHECKS_H_
 #define SRC_WINCHECKS_H_
 
+#include <stdbool.h>
 #include "gameConfiguration.h"
 
 /**
@@ -26,4 +27,24 @@
  */
 char checkWin(char field[maxFieldSize][maxFieldSize], int fieldSize);
 
+/**
+ * @brief Checks the board like 'checkWin()', but cell by cell without packed compares.
+ *
+ * This is the reference implementation the packed checks are measured and verified against.
+ *
+ * @param field The current game field.
+ * @param fieldSize The size of the game field (3x3, 4x4, 5x5, etc.).
+ * @return The character of the winner, 'd' for a draw or '\0' if the game goes on.
+ */
+char checkWinScalar(char field[maxFieldSize][maxFieldSize], int fieldSize);
+
+/**
+ * @brief Checks if every cell of the board holds a piece.
+ *
+ * @param field The current game field.
+ * @param fieldSize The size of the game field (3x3, 4x4, 5x5, etc.).
+ * @return True if the board is full, false otherwise.
+ */
+bool isDraw(char field[maxFieldSize][maxFieldSize], int fieldSize);
+
 #endif
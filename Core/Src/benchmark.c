@@ -0,0 +1,304 @@
+/**
+ * @file benchmark.c
+ * @brief Contains the engine throughput benchmark suite and its fixed position sets.
+ *
+ * The position sets are fixed so that results stay comparable across releases: do not change them,
+ * add a new set instead. All positions are undecided, with the computer ('o') to move after the player's
+ * move. The custom set comes from games with custom rules, where pairs of pieces were removed.
+ *
+ * On the target, the times are CPU cycles from the DWT cycle counter; on the host, nanoseconds from the
+ * monotonic clock. Every single measurement must stay below 2^32 ticks, about 50 s at 80 MHz.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "benchmark.h"
+#include "engine.h"
+#include "winChecks.h"
+
+#ifdef USE_HAL_DRIVER
+#include "main.h"
+#else
+#include <time.h>
+#endif
+
+#define setSize 8 /**< Number of positions in every set */
+
+/**
+ * @brief A benchmark position: the board size and its cells in row-major order, '.' for an empty cell.
+ */
+typedef struct {
+	int size;
+	const char *cells;
+} BenchmarkPosition;
+
+/**
+ * @brief A named set of benchmark positions.
+ */
+typedef struct {
+	const char *name;
+	BenchmarkPosition positions[setSize];
+} BenchmarkSet;
+
+static const BenchmarkSet sets[] = {
+	{ "3x3", {
+		{ 3, ".xo..x.ox" },
+		{ 3, "....o.xx." },
+		{ 3, "........x" },
+		{ 3, ".ox..x..." },
+		{ 3, ".x......." },
+		{ 3, "o.x..o.xx" },
+		{ 3, "oox....xx" },
+		{ 3, "..x......" },
+	} },
+	{ "4x4", {
+		{ 4, ".x..xx.o.o...o.x" },
+		{ 4, "..x.....o.ox...x" },
+		{ 4, "o...xoxo.ox..x.x" },
+		{ 4, ".......xo.x....." },
+		{ 4, "..x...o.......x." },
+		{ 4, "o...x.o...x...x." },
+		{ 4, "x.o....x.x..o..." },
+		{ 4, ".o.x.......x...." },
+	} },
+	{ "5x5", {
+		{ 5, "x...o..........o...x..x.." },
+		{ 5, "x....x...x..o.xxoo.o.ox.." },
+		{ 5, "............o...x.....x.." },
+		{ 5, "...o.o..xox....xxoxo.x..." },
+		{ 5, "x.xo.......oo.xx.xxoo...." },
+		{ 5, "...x.x.o.x....o..o...x..." },
+		{ 5, ".x.....x.....o..........." },
+		{ 5, "o..x.x....xx..oo.x.o....." },
+	} },
+	{ "custom", {
+		{ 4, "...x.....x.oxo.." },
+		{ 4, ".xo..x....xx.oo." },
+		{ 4, ".xo.ox..x....xo." },
+		{ 4, "oxx....o....x..." },
+		{ 5, "....x...........ox.o....x" },
+		{ 5, ".o.x.x.....o..o....x.x..." },
+		{ 5, "..oo.x..o....x....xx....." },
+		{ 5, ".....o...oxo...x.x.x.xo.." },
+	} },
+};
+
+#define setCount ((int) (sizeof(sets) / sizeof(sets[0]))) /**< Number of position sets */
+
+/**
+ * @brief The fixed depth of the fixed-depth runs, indexed by the board size: the default depth of the Minimax engine.
+ */
+static const int fixedDepth[maxFieldSize + 1] = { [3] = 9, [4] = 4, [5] = 3 };
+
+/**
+ * @brief Number of results written so far by the running benchmark.
+ */
+static int resultCount;
+
+#ifdef USE_HAL_DRIVER
+#define clockName "dwt" /**< Name of the clock in the output */
+
+/**
+ * @brief Enables the DWT cycle counter.
+ */
+static void StartClock(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Returns the current clock tick.
+ */
+static uint32_t ReadClock(void) {
+	return DWT->CYCCNT;
+}
+
+/**
+ * @brief Returns the number of clock ticks per second.
+ */
+static uint32_t ClockHz(void) {
+	return SystemCoreClock;
+}
+#else
+#define clockName "monotonic" /**< Name of the clock in the output */
+
+/**
+ * @brief Does nothing, the monotonic clock always runs.
+ */
+static void StartClock(void) {
+}
+
+/**
+ * @brief Returns the current clock tick.
+ */
+static uint32_t ReadClock(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t) (ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+
+/**
+ * @brief Returns the number of clock ticks per second.
+ */
+static uint32_t ClockHz(void) {
+	return 1000000000u;
+}
+#endif
+
+/**
+ * @brief Copies a benchmark position to a game board.
+ *
+ * @param position The position.
+ * @param board Receives the position; cells outside the position are emptied.
+ */
+static void LoadPosition(const BenchmarkPosition *position, char board[maxFieldSize][maxFieldSize]) {
+	for (int i = 0; i < maxFieldSize; i++) {
+		for (int j = 0; j < maxFieldSize; j++) {
+			char cell = i < position->size && j < position->size ? position->cells[i * position->size + j] : '.';
+			board[i][j] = cell == '.' ? '\0' : cell;
+		}
+	}
+}
+
+/**
+ * @brief Converts clock ticks to nanoseconds.
+ *
+ * @param ticks The number of ticks.
+ * @param count The number of operations the ticks are divided among.
+ * @return The nanoseconds per operation.
+ */
+static unsigned long TicksToNs(uint64_t ticks, unsigned long count) {
+	return count > 0 ? (unsigned long) (ticks * 1000000000ull / ClockHz() / count) : 0;
+}
+
+/**
+ * @brief Writes one result as an element of the results array.
+ *
+ * @param write Receives the output.
+ * @param result The result, a JSON object on a single line.
+ */
+static void WriteResult(BenchmarkWriter write, const char *result) {
+	write(resultCount++ > 0 ? ",\n    " : "\n    ");
+	write(result);
+}
+
+/**
+ * @brief Lets an engine choose a move on every position of a set it supports, and writes the result.
+ *
+ * @param write Receives the output.
+ * @param engine The engine.
+ * @param set The position set.
+ * @param budgetName The name of the budget in the output.
+ * @param maxNodes The node budget, or 0 for the fixed depth of every board size.
+ */
+static void RunSearch(BenchmarkWriter write, const Engine *engine, const BenchmarkSet *set, const char *budgetName,
+		unsigned long maxNodes) {
+	uint64_t ticks = 0, nodes = 0;
+	uint32_t worst = 0;
+	int positions = 0;
+
+	for (int p = 0; p < setSize; p++) {
+		const BenchmarkPosition *position = &set->positions[p];
+		if ((engine->sizes & engineSize(position->size)) == 0)
+			continue;
+
+		char board[maxFieldSize][maxFieldSize];
+		int row, column;
+		EngineStats stats = { 0 };
+		EngineBudget budget = { .maxDepth = maxNodes == 0 ? fixedDepth[position->size] : 0, .maxNodes = maxNodes };
+		LoadPosition(position, board);
+		if (engine->newGame != NULL)
+			engine->newGame(position->size);
+
+		uint32_t start = ReadClock();
+		engine->search(board, position->size, &budget, &row, &column);
+		uint32_t elapsed = ReadClock() - start;
+
+		if (engine->stats != NULL)
+			engine->stats(&stats);
+		ticks += elapsed;
+		worst = elapsed > worst ? elapsed : worst;
+		nodes += stats.nodes;
+		positions++;
+	}
+	if (positions == 0)
+		return;
+
+	char line[256];
+	snprintf(line, sizeof(line),
+			"{\"name\": \"%s/%s/%s\", \"kind\": \"search\", \"engine\": \"%s\", \"set\": \"%s\", "
+			"\"budget\": \"%s\", \"positions\": %d, \"nodes\": %lu, \"ticks\": %lu, \"nodesPerSec\": %lu, "
+			"\"nsPerOp\": %lu, \"maxNsPerOp\": %lu}", engine->name, set->name, budgetName,
+			engine->name, set->name, budgetName, positions, (unsigned long) nodes, (unsigned long) ticks,
+			ticks > 0 ? (unsigned long) (nodes * ClockHz() / ticks) : 0, TicksToNs(ticks, positions),
+			TicksToNs(worst, 1));
+	WriteResult(write, line);
+}
+
+/**
+ * @brief Times a win check on every position of a set, and writes the result.
+ *
+ * @param write Receives the output.
+ * @param check The win check.
+ * @param variant The name of the win check in the output.
+ * @param set The position set.
+ */
+static void RunCheck(BenchmarkWriter write, char (*check)(char[maxFieldSize][maxFieldSize], int), const char *variant,
+		const BenchmarkSet *set) {
+	static char boards[setSize][maxFieldSize][maxFieldSize];
+	volatile char sink = '\0';
+	for (int p = 0; p < setSize; p++)
+		LoadPosition(&set->positions[p], boards[p]);
+
+	uint32_t start = ReadClock();
+	for (int r = 0; r < BENCHMARK_CHECK_ROUNDS; r++) {
+		for (int p = 0; p < setSize; p++)
+			sink = check(boards[p], set->positions[p].size);
+	}
+	uint32_t ticks = ReadClock() - start;
+	(void) sink;
+
+	unsigned long checks = (unsigned long) BENCHMARK_CHECK_ROUNDS * setSize;
+	char line[256];
+	snprintf(line, sizeof(line),
+			"{\"name\": \"checkWin/%s/%s\", \"kind\": \"checkWin\", \"variant\": \"%s\", \"set\": \"%s\", "
+			"\"checks\": %lu, \"ticks\": %lu, \"nsPerOp\": %lu}", variant, set->name, variant, set->name, checks,
+			(unsigned long) ticks, TicksToNs(ticks, checks));
+	WriteResult(write, line);
+}
+
+void BenchmarkRun(BenchmarkWriter write) {
+	StartClock();
+	resultCount = 0;
+
+	char line[128];
+	snprintf(line, sizeof(line), "{\n  \"clock\": \"%s\",\n  \"tickHz\": %lu,\n  \"nodeBudget\": %lu,\n  \"results\": [",
+			clockName, (unsigned long) ClockHz(), (unsigned long) BENCHMARK_NODE_BUDGET);
+	write(line);
+
+	for (int e = 0; e < EngineCount(); e++) {
+		const Engine *engine = EngineAt(e);
+		bool isInUse = false;
+		for (int size = 3; size <= maxFieldSize; size++)
+			isInUse |= EngineSelected(size) == engine;
+		if (!isInUse && engine->init != NULL)
+			engine->init();
+
+		for (int s = 0; s < setCount; s++) {
+			RunSearch(write, engine, &sets[s], "depth", 0);
+			RunSearch(write, engine, &sets[s], "nodes", BENCHMARK_NODE_BUDGET);
+		}
+
+		if (!isInUse && engine->release != NULL)
+			engine->release();
+	}
+
+	for (int s = 0; s < setCount; s++) {
+		RunCheck(write, checkWin, "packed", &sets[s]);
+		RunCheck(write, checkWinScalar, "scalar", &sets[s]);
+	}
+
+	write("\n  ]\n}\n");
+}
@@ -5,15 +5,57 @@
  * This file contains the implementation of functions used to draw the game grid and the player moves 
  * on the screen using the SSD1306 OLED display. It includes functions to draw the grid of the 
  * game board, highlight the active cell, and render the 'X' and 'O' characters for each player. 
- * Additionally, it supports the ability to invert the color scheme for the display based on the 
- * 'invertThemeFlag', allowing for a dark or light theme.
+ * Additionally, it supports the ability to invert the color scheme of the field, as the result screen
+ * does. The light theme is not drawn here: the display inverts the whole image ('ssd1306_SetInvert()').
+ *
+ * The grid with its empty cells only depends on the field size and the colors, so it is drawn once into a
+ * small cache of screen images and copied into the screenbuffer on every later frame.
  */
 #include <stdbool.h>
+#include <stdint.h>
 #include "ssd1306.h"
 #include "ssd1306_fonts.h"
 #include "gameConfiguration.h"
+#include "minimax.h"
 #include "drawField.h"
 
+#define heatLevels 4 /**< Number of shades of the heat map, including the empty one */
+#define gridImageSize (WIDTH * HEIGHT / 8) /**< Bytes of a cached grid image, one screenbuffer */
+
+/**
+ * @brief A cached image of the grid and the empty cells.
+ */
+typedef struct {
+	int fieldSize; /**< Field size of the image, 0 for an unused slot */
+	bool invert; /**< Colors of the image */
+	unsigned long lastUse; /**< Value of 'gridCacheClock' when the image was last used */
+	uint8_t image[gridImageSize];
+} GridCacheSlot;
+
+static GridCacheSlot gridCache[gridCacheSlots];
+static unsigned long gridCacheClock; /**< Number of grids drawn, orders the uses of the slots */
+static unsigned long gridCacheHits, gridCacheMisses;
+
+/**
+ * @brief What a cell of the field shows.
+ */
+typedef struct {
+	char piece; /**< Character of the piece, or of the empty cell */
+	bool isActive; /**< True for the active cell */
+	bool isHint; /**< True for the cell suggested by the hint engine */
+	int level; /**< Heat map shade, 0 for none */
+} CellView;
+
+/**
+ * @brief The field as 'drawField()' last drew it on the screen.
+ */
+static struct {
+	bool isValid; /**< False if the screen was drawn over since, or nothing was drawn yet */
+	int fieldSize;
+	bool invert;
+	CellView cells[maxFieldSize][maxFieldSize];
+} boardView;
+
 /**
  * @brief Draws the grid of the game field on the screen.
  * 
@@ -39,59 +81,250 @@ void drawCells(char field[maxFieldSize][maxFieldSize], int fieldSize, bool inver
 	}
 }
 
+/**
+ * @brief Draws the grid and the empty cells over the whole screen, from the cache if possible.
+ *
+ * On a miss, the background and the grid are drawn and the screenbuffer is saved in the least recently
+ * used slot. On a hit, the saved image is copied into the screenbuffer, which marks only the columns
+ * that differ from the previous frame.
+ *
+ * @param field A 2D array representing the game board, passed on to 'drawCells()'.
+ * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
+ * @param invert A flag indicating whether to use inverted colors (black and white).
+ */
+void drawGrid(char field[maxFieldSize][maxFieldSize], int fieldSize, bool invert) {
+	GridCacheSlot *slot = &gridCache[0];
+	gridCacheClock++;
+	for (int i = 0; i < gridCacheSlots; i++) {
+		if (gridCache[i].fieldSize == fieldSize && gridCache[i].invert == invert) {
+			gridCache[i].lastUse = gridCacheClock;
+			gridCacheHits++;
+			ssd1306_FillBuffer(gridCache[i].image, gridImageSize);
+			return;
+		}
+		if (gridCache[i].lastUse < slot->lastUse)
+			slot = &gridCache[i];
+	}
+
+	gridCacheMisses++;
+	ssd1306_Fill(invert ? White : Black);
+	drawCells(field, fieldSize, invert);
+	slot->fieldSize = fieldSize;
+	slot->invert = invert;
+	slot->lastUse = gridCacheClock;
+	ssd1306_ReadBuffer(slot->image, gridImageSize);
+}
+
+void GridCacheGetStats(GridCacheStats *stats) {
+	stats->bytes = sizeof(gridCache);
+	stats->slots = gridCacheSlots;
+	stats->hits = gridCacheHits;
+	stats->misses = gridCacheMisses;
+}
+
+/**
+ * @brief Converts the move scores of the heat map into shades.
+ *
+ * The scores are spread linearly between the lowest and the highest score on the board, so the best move
+ * gets the darkest shade and the worst move none. If all moves score the same, they all get a middle shade.
+ *
+ * @param heatMap The score of every cell, 'noScore' for occupied cells.
+ * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
+ * @param levels Receives the shade of every cell, from 0 (none) to 'heatLevels' - 1.
+ */
+void heatMapLevels(int heatMap[maxFieldSize][maxFieldSize], int fieldSize, int levels[maxFieldSize][maxFieldSize]) {
+	int lowest = 0, highest = 0;
+	bool isFirst = true;
+	for (int y = 0; y < fieldSize; y++) {
+		for (int x = 0; x < fieldSize; x++) {
+			if (heatMap[y][x] == noScore)
+				continue;
+			lowest = isFirst ? heatMap[y][x] : min(lowest, heatMap[y][x]);
+			highest = isFirst ? heatMap[y][x] : max(highest, heatMap[y][x]);
+			isFirst = false;
+		}
+	}
+
+	for (int y = 0; y < fieldSize; y++) {
+		for (int x = 0; x < fieldSize; x++) {
+			if (heatMap[y][x] == noScore)
+				levels[y][x] = 0;
+			else if (highest == lowest)
+				levels[y][x] = heatLevels / 2;
+			else
+				levels[y][x] = (heatMap[y][x] - lowest) * (heatLevels - 1) / (highest - lowest);
+		}
+	}
+}
+
+/**
+ * @brief Checks whether a pixel of a heat map shade is set.
+ *
+ * The shades are ordered dither patterns covering none, 1/16, 1/4 and 1/2 of the pixels.
+ *
+ * @param level The shade, from 0 to 'heatLevels' - 1.
+ * @param x The X-coordinate of the pixel.
+ * @param y The Y-coordinate of the pixel.
+ * @return True if the pixel is drawn in the foreground color.
+ */
+bool isHeatPixel(int level, int x, int y) {
+	switch (level) {
+	case 1:
+		return x % 4 == 0 && y % 4 == 0;
+	case 2:
+		return x % 2 == 0 && y % 2 == 0;
+	case 3:
+		return (x + y) % 2 == 0;
+	default:
+		return false;
+	}
+}
+
+/**
+ * @brief Computes what every cell of the field shows.
+ *
+ * @param field A 2D array representing the game board, with 'X' and 'O' characters indicating player moves.
+ * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
+ * @param activeCellX The X-coordinate of the currently active cell (for player interaction).
+ * @param activeCellY The Y-coordinate of the currently active cell.
+ * @param heatMap The score of a move on every cell, as returned by 'AnalyseMoves()', or NULL for no heat map.
+ * @param hintCellX The X-coordinate of the suggested cell, or -1 for no hint.
+ * @param hintCellY The Y-coordinate of the suggested cell, or -1 for no hint.
+ * @param cells Receives the view of every cell.
+ */
+void cellViews(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY,
+		int heatMap[maxFieldSize][maxFieldSize], int hintCellX, int hintCellY, CellView cells[maxFieldSize][maxFieldSize]) {
+	int levels[maxFieldSize][maxFieldSize] = { { 0 } };
+	if (heatMap != NULL)
+		heatMapLevels(heatMap, fieldSize, levels);
+	for (int y = 0; y < fieldSize; y++) {
+		for (int x = 0; x < fieldSize; x++) {
+			bool isActive = activeCellX == x && activeCellY == y;
+			cells[y][x] = (CellView) { field[y][x], isActive, hintCellX == x && hintCellY == y,
+					isActive ? 0 : levels[y][x] };
+		}
+	}
+}
+
+/**
+ * @brief Checks whether two cells show the same.
+ *
+ * @param a One cell.
+ * @param b The other cell.
+ * @return True if the cells are drawn the same.
+ */
+bool isSameCell(const CellView *a, const CellView *b) {
+	return a->piece == b->piece && a->isActive == b->isActive && a->isHint == b->isHint && a->level == b->level;
+}
+
+/**
+ * @brief Draws the inside of a cell: the active cell highlight, the heat map shade, the hint frame and the piece.
+ *
+ * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
+ * @param x The X-coordinate of the cell.
+ * @param y The Y-coordinate of the cell.
+ * @param cell What the cell shows.
+ * @param invert A flag indicating whether to use inverted colors (black and white).
+ * @param isBlank True if the inside of the cell is known to be in the background color, as 'drawGrid()' leaves it.
+ */
+void drawCell(int fieldSize, int x, int y, const CellView *cell, bool invert, bool isBlank) {
+	int height = HEIGHT - playerTextCorrection;
+	int cellSize = height / fieldSize;
+	int xMargin = (WIDTH - cellSize * fieldSize) / 2;
+	int selectionBorderX = xMargin + cellSize * x;
+	int selectionBorderY = playerTextCorrection + cellSize * y;
+	if (cell->isActive || !isBlank) {
+		ssd1306_FillRectangle(selectionBorderX + 1, selectionBorderY + 1,
+							selectionBorderX + cellSize - 1,
+							selectionBorderY + cellSize - 1, cell->isActive ? (invert ? Black : White) : (invert ? White : Black));
+	}
+	if (cell->level > 0) {
+		for (int py = selectionBorderY + 1; py < selectionBorderY + cellSize; py++) {
+			for (int px = selectionBorderX + 1; px < selectionBorderX + cellSize; px++) {
+				if (isHeatPixel(cell->level, px, py))
+					ssd1306_DrawPixel(px, py, invert ? Black : White);
+			}
+		}
+	}
+	if (cell->isHint) {
+		ssd1306_DrawRectangle(selectionBorderX + 2, selectionBorderY + 2,
+				selectionBorderX + cellSize - 2, selectionBorderY + cellSize - 2,
+				cell->isActive ? (invert ? White : Black) : (invert ? Black : White));
+	}
+	ssd1306_SetCursor(
+			xMargin + cellSize * x + (cellSize - xoWidth) / 2 + 1,
+			playerTextCorrection + cellSize * y
+					+ (cellSize - xoHeight) / 2);
+	ssd1306_WriteChar(cell->piece, Font_6x8, cell->isActive ? (invert ? White : Black) : (invert ? Black : White));
+}
+
 /**
  * @brief Draws 'X' and 'O' symbols in the game cells on the screen.
  *
  * This function displays 'X' and 'O' in their respective grid positions based on the game state. It also highlights
  * the currently active cell (where the player can make a move) with the appropriate colors based on the 'invert' flag.
+ * The other cells are expected empty in the background color, as 'drawGrid()' leaves them.
+ * If a heat map is given, the empty cells other than the active one are shaded by the score of a move there.
+ * The cell suggested by the hint engine is marked with a frame.
  * 
  * @param field A 2D array representing the game board, with 'X' and 'O' characters indicating player moves.
  * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
  * @param activeCellX The X-coordinate of the currently active cell (for player interaction).
  * @param activeCellY The Y-coordinate of the currently active cell.
  * @param invert A flag indicating whether to use inverted colors (black and white).
+ * @param heatMap The score of a move on every cell, as returned by 'AnalyseMoves()', or NULL for no heat map.
+ * @param hintCellX The X-coordinate of the suggested cell, or -1 for no hint.
+ * @param hintCellY The Y-coordinate of the suggested cell, or -1 for no hint.
  */
-void drawXO(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert) {
-	int height = HEIGHT - playerTextCorrection;
-	int cellSize = height / fieldSize;
-	int xMargin = (WIDTH - cellSize * fieldSize) / 2;
+void drawXO(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert,
+		int heatMap[maxFieldSize][maxFieldSize], int hintCellX, int hintCellY) {
+	CellView cells[maxFieldSize][maxFieldSize];
+	cellViews(field, fieldSize, activeCellX, activeCellY, heatMap, hintCellX, hintCellY, cells);
 	for (int y = 0; y < fieldSize; y++) {
-		for (int x = 0; x < fieldSize; x++) {
-			bool isActive = activeCellX == x && activeCellY == y;
-			int selectionBorderX = xMargin + cellSize * x;
-			int selectionBorderY = playerTextCorrection + cellSize * y;
-			ssd1306_FillRectangle(selectionBorderX + 1, selectionBorderY + 1,
-								selectionBorderX + cellSize - 1,
-								selectionBorderY + cellSize - 1, isActive ? (invert ? Black : White) : (invert ? White : Black));
-			ssd1306_SetCursor(
-					xMargin + cellSize * x + (cellSize - xoWidth) / 2 + 1,
-					playerTextCorrection + cellSize * y
-							+ (cellSize - xoHeight) / 2);
-			ssd1306_WriteChar(field[y][x], Font_6x8, isActive ? (invert ? White : Black) : (invert ? Black : White));
-		}
+		for (int x = 0; x < fieldSize; x++)
+			drawCell(fieldSize, x, y, &cells[y][x], invert, true);
 	}
 }
 
 /**
  * @brief Draws the complete game field on the screen, including the grid and player moves.
  *
- * This function combines both drawing the grid and the player moves. It also handles the display
- * inversion theme based on the provided 'invertThemeFlag' parameter. The function uses 'invert' to determine 
- * the theme.
+ * This function combines both drawing the grid and the player moves. The function uses 'invert' to determine 
+ * the colors; the theme is applied by the display.
+ *
+ * The field it drew last is retained: if the field size and the colors are the same, only the cells that show
+ * something else are redrawn, so only their bytes are marked for the flush. Otherwise the whole screen is
+ * redrawn, the grid from the cache of 'drawGrid()'.
  * 
  * @param field A 2D array representing the game board, with 'X' and 'O' characters indicating player moves.
  * @param fieldSize The size of the game field (e.g., 3x3, 4x4, etc.).
  * @param activeCellX The X-coordinate of the currently active cell (for player interaction).
  * @param activeCellY The Y-coordinate of the currently active cell.
  * @param invert A flag indicating whether to use inverted colors (black and white).
- * @param invertThemeFlag A flag determining whether the theme (light/dark) should be inverted.
+ * @param heatMap The score of a move on every cell, as returned by 'AnalyseMoves()', or NULL for no heat map.
+ * @param hintCellX The X-coordinate of the cell suggested by the hint engine, or -1 for no hint.
+ * @param hintCellY The Y-coordinate of the cell suggested by the hint engine, or -1 for no hint.
  */
-void drawField(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert, bool invertThemeFlag){
-	invert = invertThemeFlag ? !invert : invert;
-	if (invert){
-		ssd1306_Fill(White);
+void drawField(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert,
+		int heatMap[maxFieldSize][maxFieldSize], int hintCellX, int hintCellY){
+	CellView cells[maxFieldSize][maxFieldSize];
+	cellViews(field, fieldSize, activeCellX, activeCellY, heatMap, hintCellX, hintCellY, cells);
+	bool isFull = !boardView.isValid || boardView.fieldSize != fieldSize || boardView.invert != invert;
+	if (isFull)
+		drawGrid(field, fieldSize, invert);
+	for (int y = 0; y < fieldSize; y++) {
+		for (int x = 0; x < fieldSize; x++) {
+			if (isFull || !isSameCell(&cells[y][x], &boardView.cells[y][x])) {
+				drawCell(fieldSize, x, y, &cells[y][x], invert, isFull);
+				boardView.cells[y][x] = cells[y][x];
+			}
+		}
 	}
-	drawCells(field, fieldSize, invert);
-	drawXO(field, fieldSize, activeCellX, activeCellY, invert);
+	boardView.isValid = true;
+	boardView.fieldSize = fieldSize;
+	boardView.invert = invert;
 }
 
+void BoardViewInvalidate(void) {
+	boardView.isValid = false;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file engine.c
+ * @brief Contains the registry of the computer's move engines and the selection per board size.
+ *
+ * The registry lists every engine built into the firmware. For every board size, one of them is
+ * selected; the game makes the computer's moves through 'EngineMove()', which forwards to that engine.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "engine.h"
+
+/**
+ * @brief All engines built into the firmware.
+ */
+static const Engine *const engines[] = { &minimaxEngine, &tableEngine, };
+
+#define engineCount ((int) (sizeof(engines) / sizeof(engines[0]))) /**< Number of registered engines */
+
+/**
+ * @brief The engine selected for every board size, indexed by the size.
+ */
+static const Engine *selected[maxFieldSize + 1] = {
+	[3] = &tableEngine,
+	[4] = &minimaxEngine,
+	[5] = &minimaxEngine,
+};
+
+int EngineCount(void) {
+	return engineCount;
+}
+
+const Engine* EngineAt(int index) {
+	return engines[index];
+}
+
+const Engine* EngineFind(const char *name) {
+	for (int i = 0; i < engineCount; i++) {
+		if (strcmp(engines[i]->name, name) == 0)
+			return engines[i];
+	}
+	return NULL;
+}
+
+/**
+ * @brief Checks whether an engine is selected for any board size.
+ *
+ * @param engine The engine.
+ * @return True if the engine is in use.
+ */
+static bool isInUse(const Engine *engine) {
+	for (int size = 3; size <= maxFieldSize; size++) {
+		if (selected[size] == engine)
+			return true;
+	}
+	return false;
+}
+
+bool EngineSelect(int size, const Engine *engine) {
+	if (size < 3 || size > maxFieldSize || (engine->sizes & engineSize(size)) == 0)
+		return false;
+
+	const Engine *previous = selected[size];
+	if (previous == engine)
+		return true;
+	if (!isInUse(engine) && engine->init != NULL)
+		engine->init();
+	selected[size] = engine;
+	if (!isInUse(previous) && previous->release != NULL)
+		previous->release();
+	return true;
+}
+
+const Engine* EngineSelected(int size) {
+	return selected[size];
+}
+
+void EngineInit(void) {
+	for (int i = 0; i < engineCount; i++) {
+		if (isInUse(engines[i]) && engines[i]->init != NULL)
+			engines[i]->init();
+	}
+}
+
+void EngineNewGame(int size) {
+	if (selected[size]->newGame != NULL)
+		selected[size]->newGame(size);
+}
+
+bool EngineMove(char board[maxFieldSize][maxFieldSize], int size) {
+	static const EngineBudget defaultBudget = { 0 };
+	int row, column;
+	if (!selected[size]->search(board, size, &defaultBudget, &row, &column))
+		return false;
+
+	board[row][column] = secondPlayerChar;
+	return true;
+}
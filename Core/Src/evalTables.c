@@ -0,0 +1,156 @@
+/**
+ * @file evalTables.c
+ * @brief Pattern tables for the horizon evaluation.
+ *
+ * This file is generated by Tools/genEvalTables.c. Do not edit it by hand.
+ */
+#include "evaluation.h"
+
+static const int16_t scores3[27] = {
+	0, 1, -1, 1, 10, 0, -1, 0, -10,
+	1, 10, 0, 10, 0, 0, 0, 0, 0,
+	-1, 0, -10, 0, 0, 0, -10, 0, 0,
+};
+
+static const uint8_t threats3[27] = {
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+};
+
+static const int16_t scores4[81] = {
+	0, 1, -1, 1, 5, 0, -1, 0, -5,
+	1, 5, 0, 5, 25, 0, 0, 0, 0,
+	-1, 0, -5, 0, 0, 0, -5, 0, -25,
+	1, 5, 0, 5, 25, 0, 0, 0, 0,
+	5, 25, 0, 25, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	-1, 0, -5, 0, 0, 0, -5, 0, -25,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	-5, 0, -25, 0, 0, 0, -25, 0, 0,
+};
+
+static const uint8_t threats4[81] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+};
+
+static const uint8_t windows3x3[] = {
+	0, 1, 2,
+	5, 6, 7,
+	10, 11, 12,
+	0, 5, 10,
+	1, 6, 11,
+	2, 7, 12,
+	0, 6, 12,
+	2, 6, 10,
+};
+
+static const uint8_t cellWindows3x3[] = {
+	0, 3, 6, 0, 4, 0, 5, 7, 1, 3, 1, 4, 6, 7, 1, 5,
+	2, 3, 7, 2, 4, 2, 5, 6,
+};
+
+static const uint8_t cellWindowStart3x3[] = {
+	0, 3, 5, 8, 8, 8, 10, 14, 16, 16, 16, 19, 21, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+};
+
+static const uint8_t windows4x4[] = {
+	0, 1, 2,
+	1, 2, 3,
+	5, 6, 7,
+	6, 7, 8,
+	10, 11, 12,
+	11, 12, 13,
+	15, 16, 17,
+	16, 17, 18,
+	0, 5, 10,
+	1, 6, 11,
+	2, 7, 12,
+	3, 8, 13,
+	5, 10, 15,
+	6, 11, 16,
+	7, 12, 17,
+	8, 13, 18,
+	0, 6, 12,
+	1, 7, 13,
+	5, 11, 17,
+	6, 12, 18,
+	2, 6, 10,
+	3, 7, 11,
+	7, 11, 15,
+	8, 12, 16,
+};
+
+static const uint8_t cellWindows4x4[] = {
+	0, 8, 16, 0, 1, 9, 17, 0, 1, 10, 20, 1, 11, 21, 2, 8,
+	12, 18, 2, 3, 9, 13, 16, 19, 20, 2, 3, 10, 14, 17, 21, 22,
+	3, 11, 15, 23, 4, 8, 12, 20, 4, 5, 9, 13, 18, 21, 22, 4,
+	5, 10, 14, 16, 19, 23, 5, 11, 15, 17, 6, 12, 22, 6, 7, 13,
+	23, 6, 7, 14, 18, 7, 15, 19,
+};
+
+static const uint8_t cellWindowStart4x4[] = {
+	0, 3, 7, 11, 14, 14, 18, 25, 32, 36, 36, 40, 47, 54, 58, 58,
+	61, 65, 69, 72, 72, 72, 72, 72, 72, 72,
+};
+
+static const uint8_t windows5x5[] = {
+	0, 1, 2, 3,
+	1, 2, 3, 4,
+	5, 6, 7, 8,
+	6, 7, 8, 9,
+	10, 11, 12, 13,
+	11, 12, 13, 14,
+	15, 16, 17, 18,
+	16, 17, 18, 19,
+	20, 21, 22, 23,
+	21, 22, 23, 24,
+	0, 5, 10, 15,
+	1, 6, 11, 16,
+	2, 7, 12, 17,
+	3, 8, 13, 18,
+	4, 9, 14, 19,
+	5, 10, 15, 20,
+	6, 11, 16, 21,
+	7, 12, 17, 22,
+	8, 13, 18, 23,
+	9, 14, 19, 24,
+	0, 6, 12, 18,
+	1, 7, 13, 19,
+	5, 11, 17, 23,
+	6, 12, 18, 24,
+	3, 7, 11, 15,
+	4, 8, 12, 16,
+	8, 12, 16, 20,
+	9, 13, 17, 21,
+};
+
+static const uint8_t cellWindows5x5[] = {
+	0, 10, 20, 0, 1, 11, 21, 0, 1, 12, 0, 1, 13, 24, 1, 14,
+	25, 2, 10, 15, 22, 2, 3, 11, 16, 20, 23, 2, 3, 12, 17, 21,
+	24, 2, 3, 13, 18, 25, 26, 3, 14, 19, 27, 4, 10, 15, 4, 5,
+	11, 16, 22, 24, 4, 5, 12, 17, 20, 23, 25, 26, 4, 5, 13, 18,
+	21, 27, 5, 14, 19, 6, 10, 15, 24, 6, 7, 11, 16, 25, 26, 6,
+	7, 12, 17, 22, 27, 6, 7, 13, 18, 20, 23, 7, 14, 19, 21, 8,
+	15, 26, 8, 9, 16, 27, 8, 9, 17, 8, 9, 18, 22, 9, 19, 23,
+};
+
+static const uint8_t cellWindowStart5x5[] = {
+	0, 3, 7, 10, 14, 17, 21, 27, 33, 39, 43, 46, 52, 60, 66, 69,
+	73, 79, 85, 91, 95, 98, 102, 105, 109, 112,
+};
+
+const EvalMode evalModes[maxFieldSize - 2] = {
+	{ 3, 3, 8, windows3x3, cellWindowStart3x3, cellWindows3x3, scores3, threats3 },
+	{ 4, 3, 24, windows4x4, cellWindowStart4x4, cellWindows4x4, scores3, threats3 },
+	{ 5, 4, 28, windows5x5, cellWindowStart5x5, cellWindows5x5, scores4, threats4 },
+};
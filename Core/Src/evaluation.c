@@ -0,0 +1,64 @@
+/**
+ * @file evaluation.c
+ * @brief Contains the implementation of the table-driven static evaluation.
+ *
+ * The evaluation is used by the Minimax algorithm when the search reaches its maximum depth before
+ * the game is decided. Instead of counting pieces line by line with branches, every window is turned
+ * into an index into a precomputed score table, so the evaluation is a branch-free sum of table reads.
+ */
+#include "evaluation.h"
+
+/**
+ * @brief Returns the base-3 digit of a single cell.
+ *
+ * @param cell The content of the cell.
+ * @return 0 for an empty cell, 1 for the computer's piece and 2 for the player's piece.
+ */
+static inline int cellDigit(char cell) {
+	return (cell == secondPlayerChar) + 2 * (cell == firstPlayerChar);
+}
+
+int EvaluateBoard(char board[maxFieldSize][maxFieldSize], int size) {
+	const EvalMode *mode = &evalModes[size - 3];
+	const char *cells = &board[0][0];
+	const uint8_t *window = mode->windowCells;
+	int score = 0;
+
+	if (mode->toWin == 3) {
+		for (int i = 0; i < mode->windowCount; i++, window += 3) {
+			score += mode->scores[cellDigit(cells[window[0]]) + 3 * cellDigit(cells[window[1]])
+					+ 9 * cellDigit(cells[window[2]])];
+		}
+	} else {
+		for (int i = 0; i < mode->windowCount; i++, window += mode->toWin) {
+			int index = 0;
+			for (int k = mode->toWin - 1; k >= 0; k--)
+				index = index * 3 + cellDigit(cells[window[k]]);
+			score += mode->scores[index];
+		}
+	}
+
+	return score;
+}
+
+int FindThreats(char board[maxFieldSize][maxFieldSize], int size, char player, int threatCells[2]) {
+	const EvalMode *mode = &evalModes[size - 3];
+	const char *cells = &board[0][0];
+	const uint8_t *window = mode->windowCells;
+	int shift = player == secondPlayerChar ? 0 : 4;
+	int count = 0;
+
+	for (int i = 0; i < mode->windowCount && count < 2; i++, window += mode->toWin) {
+		int index = 0;
+		for (int k = mode->toWin - 1; k >= 0; k--)
+			index = index * 3 + cellDigit(cells[window[k]]);
+		int position = (mode->threats[index] >> shift) & 0x0F;
+		if (position == 0)
+			continue;
+		int cell = window[position - 1];
+		if (count == 0 || threatCells[0] != cell)
+			threatCells[count++] = cell;
+	}
+
+	return count;
+}
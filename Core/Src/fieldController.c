@@ -22,6 +22,13 @@ char field[maxFieldSize][maxFieldSize];
  * to allocate the field array.
  */
 int fieldSize = maxFieldSize;
+/**
+ * @brief Counter that changes every time the game field is modified.
+ *
+ * Background computations on the field, such as the hint analysis, compare it with the value they
+ * started with to notice that their result is outdated.
+ */
+volatile uint32_t fieldVersion = 0;
 
 /**
  * @brief Clears the game field.
@@ -35,6 +42,7 @@ void clearField() {
 			field[i][j] = '\0';
 		}
 	}
+	fieldVersion++;
 }
 
 /**
@@ -46,7 +54,8 @@ void clearField() {
  * returns 'true'. If the cell is already occupied, the function returns 'false'.
  * 
  * The function also ensures that the game board is not modified in any way 
- * when trying to place a character in an already occupied cell.
+ * when trying to place a character in an already occupied cell. Placing a character changes
+ * 'fieldVersion', which cancels a running hint analysis of the previous position.
  *
  * @param x The x-coordinate of the cell.
  * @param y The y-coordinate of the cell.
@@ -56,6 +65,9 @@ void clearField() {
 bool placeChar(int x, int y, char toPlace) {
 	bool isFree = field[y][x] == '\0';
 	field[y][x] = isFree ? toPlace : field[y][x];
+	if (isFree) {
+		fieldVersion++;
+	}
 
 	return isFree;
 }
@@ -0,0 +1,114 @@
+/**
+ * @file hint.c
+ * @brief Contains the implementation of the background hint engine.
+ *
+ * The computer's own moves are searched inside the UART interrupt, which blocks input until they are done.
+ * Hints are instead computed during the idle time of the main loop with the incremental analysis of
+ * 'minimax.c': every call of 'HintStep()' searches one root move, so the display and the input stay
+ * responsive. The analysis works on a copy of the field and is cancelled through 'fieldVersion' when
+ * an interrupt changes the field. Finished analyses are kept in a small cache keyed by the position.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "hint.h"
+#include "minimax.h"
+#include "fieldController.h"
+
+/**
+ * @brief An analysed position in the hint cache.
+ */
+typedef struct {
+	bool isValid; /**< True if the entry holds an analysis */
+	char board[maxFieldSize][maxFieldSize]; /**< The analysed position */
+	int size; /**< The size of the game board */
+	char toMove; /**< The character of the player to move */
+	int scores[maxFieldSize][maxFieldSize]; /**< The scores of all moves, as reported by 'AnalyseMoves()' */
+	int hintX; /**< The column of the best move */
+	int hintY; /**< The row of the best move */
+} HintEntry;
+
+static HintEntry cache[HINT_CACHE_SIZE];
+static int nextEntry = 0; /**< Cache entry replaced by the next finished analysis */
+
+static Analysis analysis; /**< The running analysis */
+static HintEntry running; /**< Position of the running analysis, 'isValid' is true while it runs */
+
+/**
+ * @brief Finds the cache entry of the position on the game field.
+ *
+ * @param toMove The character of the player to move.
+ * @return The cache entry, or NULL if the position has not been analysed.
+ */
+static HintEntry* FindEntry(char toMove) {
+	for (int i = 0; i < HINT_CACHE_SIZE; i++) {
+		if (cache[i].isValid && cache[i].size == fieldSize && cache[i].toMove == toMove
+				&& memcmp(cache[i].board, field, sizeof(cache[i].board)) == 0)
+			return &cache[i];
+	}
+	return NULL;
+}
+
+/**
+ * @brief Stores the finished analysis in the cache, replacing the oldest entry.
+ */
+static void StoreRunning(void) {
+	HintEntry *entry = &cache[nextEntry];
+	nextEntry = (nextEntry + 1) % HINT_CACHE_SIZE;
+
+	*entry = running;
+	entry->hintX = -1;
+	entry->hintY = -1;
+	int bestScore = noScore;
+	for (int y = 0; y < running.size; y++) {
+		for (int x = 0; x < running.size; x++) {
+			entry->scores[y][x] = analysis.scores[y][x];
+			if (analysis.scores[y][x] > bestScore) {
+				bestScore = analysis.scores[y][x];
+				entry->hintX = x;
+				entry->hintY = y;
+			}
+		}
+	}
+	entry->isValid = entry->hintX >= 0;
+}
+
+bool HintStep(char toMove) {
+	if (FindEntry(toMove) != NULL)
+		return false;
+
+	if (!running.isValid || running.size != fieldSize || running.toMove != toMove
+			|| memcmp(running.board, field, sizeof(running.board)) != 0) {
+		// The version is read before the field is copied, so a change during the copy cancels the analysis.
+		AnalysisStart(&analysis, field, fieldSize, toMove, &fieldVersion);
+		memcpy(running.board, field, sizeof(running.board));
+		running.size = fieldSize;
+		running.toMove = toMove;
+		running.isValid = true;
+	}
+
+	switch (AnalysisStep(&analysis)) {
+	case analysisRunning:
+		return false;
+	case analysisCancelled:
+		running.isValid = false;
+		return false;
+	case analysisDone:
+		break;
+	}
+
+	running.isValid = false;
+	StoreRunning();
+	return true;
+}
+
+bool HintLookup(char toMove, int scores[maxFieldSize][maxFieldSize], int *hintX, int *hintY) {
+	HintEntry *entry = FindEntry(toMove);
+	if (entry == NULL)
+		return false;
+
+	if (scores != NULL)
+		memcpy(scores, entry->scores, sizeof(entry->scores));
+	*hintX = entry->hintX;
+	*hintY = entry->hintY;
+	return true;
+}
@@ -69,13 +69,17 @@
 #include "ssd1306_fonts.h"
 #include "sx1509.h"
 #include <stdbool.h>
+#include <string.h>
 
 #include "gameConfiguration.h"
 #include "fieldController.h"
 #include "minimax.h"
+#include "engine.h"
 #include "winChecks.h"
 #include "findRandom.h"
 #include "drawField.h"
+#include "hint.h"
+#include "benchmark.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -102,6 +106,14 @@
  */
 I2C_HandleTypeDef hi2c1;
 
+/**
+ * @brief Structure for managing the DMA channel of the I2C transmitter.
+ *
+ * The variable 'hdma_i2c1_tx' is linked to 'hi2c1' and streams the screenbuffer to the display
+ * while the CPU keeps running.
+ */
+DMA_HandleTypeDef hdma_i2c1_tx;
+
 /**
  * @brief Structure for managing the SPI interface.
  *
@@ -110,6 +122,14 @@ I2C_HandleTypeDef hi2c1;
  */
 SPI_HandleTypeDef hspi1;
 
+/**
+ * @brief Structure for managing the DMA channel of the SPI transmitter.
+ *
+ * The variable 'hdma_spi1_tx' is linked to 'hspi1' and streams the screenbuffer to the display
+ * when the display is wired to SPI (SSD1306_USE_SPI).
+ */
+DMA_HandleTypeDef hdma_spi1_tx;
+
 /**
  * @brief Structure for managing the UART interface.
  *
@@ -125,6 +145,7 @@ UART_HandleTypeDef huart2;
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_I2C1_Init(void);
 static void MX_SPI1_Init(void);
 static void MX_USART2_UART_Init(void);
@@ -180,6 +201,14 @@ uint8_t uart_rx_buffer;
  * of changes in the game or menu state.
  */
 bool isNeedToUpdate = true;
+/**
+ * @brief Flag indicating that the computer's move is due.
+ *
+ * The UART interrupt sets it after the player's move in single-player mode, and the main loop makes
+ * the computer's move and clears it, so the search and the display transfers never run in the interrupt.
+ * Game input is ignored while it is set.
+ */
+volatile bool isComputerToMove = false;
 /**
  * @brief Flag indicating whether the game should continue.
  *
@@ -212,8 +241,25 @@ int movesToNextRemoval = -1;
  *
  * The variable is set to 'true' if the color theme of the game
  * should be inverted, which might be useful in low-light conditions.
+ * The screens are always drawn in the dark theme; the display inverts
+ * them by itself ('ssd1306_SetInvert()'), which the main loop switches
+ * when it redraws the options menu.
  */
 bool invertThemeFlag = false;
+/**
+ * @brief Flag indicating whether the move heat map is shown on the game screen.
+ *
+ * The variable is toggled with the 'm' key during the game. When it is set, every empty cell
+ * is shaded according to the score of a move there for the player to move.
+ */
+bool heatMapFlag = false;
+/**
+ * @brief Flag indicating whether the suggested move is shown on the game screen.
+ *
+ * The variable is toggled with the 'h' key during the game. When it is set, the cell
+ * suggested by the hint engine is marked with a frame once its analysis is finished.
+ */
+bool hintFlag = false;
 
 /**
  * @brief Game states.
@@ -317,17 +363,16 @@ char optionsButtons[][WIDTH / mainFontWidth] = { "+5x5", "-4x4", "-3x3",
  */
 void displayMenu(char buttons[][WIDTH / mainFontWidth], int buttonsCount,
 		int activeButton) {
-	if (invertThemeFlag) ssd1306_Fill(White);
 	int gap = (HEIGHT - buttonsCount * mainFontHeight) / (buttonsCount + 1);
 	int selectionY = gap * activeButton
 			+ mainFontHeight * (activeButton - 1)- selectionPadding;
 
 	ssd1306_DrawRectangle(15, selectionY, 113,
-			selectionY + mainFontHeight + selectionPadding, invertThemeFlag ? Black : White);
+			selectionY + mainFontHeight + selectionPadding, White);
 	for (int i = 0; i < buttonsCount; i++) {
 		int startX = (WIDTH - strlen(buttons[i]) * mainFontWidth) / 2;
 		ssd1306_SetCursor(startX, gap * (i + 1) + mainFontHeight * i);
-		ssd1306_WriteString(buttons[i], Font_7x10, invertThemeFlag ? Black : White);
+		ssd1306_WriteString(buttons[i], Font_7x10, White);
 	}
 }
 
@@ -357,6 +402,7 @@ void setGameToContinue(bool state){
  */
 void setupNewGame() {
 	clearField();
+	EngineNewGame(fieldSize);
 	setGameToContinue(false);
 	playerFlag = true;
 	activeCellX = 0;
@@ -379,25 +425,35 @@ void setupNewGame() {
 void winScreen(char winner) {
 	activeCellX = -1;
 	activeCellY = -1;
-	drawField(field, fieldSize, activeCellX, activeCellY, true, invertThemeFlag);
+	drawField(field, fieldSize, activeCellX, activeCellY, true, NULL, -1, -1);
 	ssd1306_SetCursor(1, 1);
 	if (winner == 'd') {
-		ssd1306_WriteString("Draw!", Font_6x8, invertThemeFlag ? White : Black);
+		ssd1306_WriteString("Draw!", Font_6x8, Black);
 		return;
 	}
 	if (winner != '\0') {
 		ssd1306_WriteString(winner == firstPlayerChar ? "P1 Won!" : "P2 Won!",
-				Font_6x8, invertThemeFlag ? White : Black);
+				Font_6x8, Black);
 		return;
 	}
 }
 
+/**
+ * @brief Function checks whether a human player is to move.
+ *
+ * @return 'true' in two-player mode and on the player's turn in single-player mode.
+ */
+bool isHumanToMove() {
+	return !singlePlayerFlag || playerFlag;
+}
+
 /**
  * @brief Function draws the game field and checks if the game has ended.
  *
  * The function checks the game result, and if a player has won, it calls the end screen 
  * with the appropriate winner message. If the game is not finished, it redraws the game field 
- * and displays whose turn it is.
+ * and displays whose turn it is. If the heat map or the hint is enabled, a human player is to move
+ * and the hint engine has finished analysing the position, they are drawn on the field.
  */
 void drawGame() {
 	char winner = checkWin(field, fieldSize);
@@ -406,23 +462,31 @@ void drawGame() {
 		currentState = gameResult;
 		return winScreen(winner);
 	}
-	drawField(field, fieldSize, activeCellX, activeCellY, false, invertThemeFlag);
+	int heatMap[maxFieldSize][maxFieldSize];
+	int hintX = -1, hintY = -1;
+	bool isAnalysed = (heatMapFlag || hintFlag) && isHumanToMove()
+			&& HintLookup(playerFlag ? firstPlayerChar : secondPlayerChar, heatMap, &hintX, &hintY);
+	drawField(field, fieldSize, activeCellX, activeCellY, false,
+			isAnalysed && heatMapFlag ? heatMap : NULL, isAnalysed && hintFlag ? hintX : -1,
+			isAnalysed && hintFlag ? hintY : -1);
 	ssd1306_SetCursor(1, 1);
-	ssd1306_WriteString(playerFlag ? "Player 1" : "Player 2", Font_6x8, invertThemeFlag ? Black : White);
+	ssd1306_WriteString(playerFlag ? "Player 1" : "Player 2", Font_6x8, White);
 }
 
 /**
  * @brief Function makes the computer's move in the game.
  *
- * This function toggles the player flag, redraws the game field, and then makes the computer's move. 
+ * This function toggles the player flag, redraws the game field, and then makes the computer's move
+ * with the engine selected for the field size. The redrawn field is sent to the display by DMA while
+ * the engine searches. It is called from the main loop once 'isComputerToMove' is set.
  * After the computer makes its move, the player flag is toggled again to indicate it is the player's turn.
  */
 void computersTurn() {
 	playerFlag = !playerFlag;
-	ssd1306_Fill(Black);
 	drawGame();
-	ssd1306_UpdateScreen();
-	ComputerMove(field, fieldSize);
+	while (ssd1306_UpdateScreenAsync() == SSD1306_BUSY)
+		;
+	EngineMove(field, fieldSize);
 	playerFlag = !playerFlag;
 }
 
@@ -478,10 +542,13 @@ void mainMenuInputEvent() {
  *
  * The function responds to player input events for movement and for confirming a move by placing 
  * a symbol on the game field. It also handles custom mode logic, where after a certain number of moves,
- * random symbols may be removed from the field. In single-player mode, it triggers the computer's 
- * turn after the player's move.
+ * random symbols may be removed from the field. In single-player mode, it leaves the computer's
+ * turn after the player's move to the main loop and ignores input until it is made. The 'h' key
+ * shows or hides the suggested move and the 'm' key the move heat map.
  */
 void gameInputEvent() {
+	if (isComputerToMove)
+		return;
 	switch (uart_rx_buffer) {
 	case 'a':
 		activeCellX--;
@@ -526,11 +593,17 @@ void gameInputEvent() {
 			movesToNextRemoval--;
 		}
 		if (singlePlayerFlag && isFree) {
-			computersTurn();
+			isComputerToMove = true;
 		} else {
 			playerFlag = isFree ? !playerFlag : playerFlag;
 		}
 		break;
+	case 'h':
+		hintFlag = !hintFlag;
+		break;
+	case 'm':
+		heatMapFlag = !heatMapFlag;
+		break;
 	case 'q':
 		currentState = mainMenu;
 		break;
@@ -630,6 +703,17 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
 	}
 }
 
+#ifdef ENGINE_BENCHMARK
+/**
+ * @brief Sends a piece of the benchmark output over the UART.
+ *
+ * @param text The piece of output.
+ */
+static void writeBenchmark(const char *text) {
+	HAL_UART_Transmit(&huart2, (uint8_t*) text, strlen(text), HAL_MAX_DELAY);
+}
+#endif
+
 /* USER CODE END 0 */
 
 /**
@@ -660,12 +744,17 @@ int main(void) {
 
 	/* Initialize all configured peripherals */
 	MX_GPIO_Init();
+	MX_DMA_Init();
 	MX_I2C1_Init();
 	MX_SPI1_Init();
 	MX_USART2_UART_Init();
 	/* USER CODE BEGIN 2 */
 
 	ssd1306_Init();
+	EngineInit();
+#ifdef ENGINE_BENCHMARK
+	BenchmarkRun(writeBenchmark);
+#endif
 	srand(time(NULL));
 
 	/* USER CODE END 2 */
@@ -673,11 +762,18 @@ int main(void) {
 	/* Infinite loop */
 	/* USER CODE BEGIN WHILE */
 	while (1) {
+		if (isComputerToMove) {
+			computersTurn();
+			isComputerToMove = false;
+			isNeedToUpdate = true;
+		}
 		if (isNeedToUpdate) {
 			isNeedToUpdate = false;
-			ssd1306_Fill(Black);
+			// The game screens redraw the cells that changed, or the whole screen over the cached grid
 			switch (currentState) {
 			case mainMenu:
+				BoardViewInvalidate();
+				ssd1306_Fill(Black);
 				displayMenu(mainMenuButtons, mainMenuButtonsCount,
 						activeMainButton);
 				break;
@@ -685,6 +781,10 @@ int main(void) {
 				drawGame();
 				break;
 			case options:
+				if (ssd1306_GetInvert() != invertThemeFlag)
+					ssd1306_SetInvert(invertThemeFlag);
+				BoardViewInvalidate();
+				ssd1306_Fill(Black);
 				displayMenu(optionsButtons, optionsButtonsCount,
 						activeOptionButton);
 				break;
@@ -692,7 +792,14 @@ int main(void) {
 				winScreen(lastWinner);
 				break;
 			}
-			ssd1306_UpdateScreen();
+		}
+		if (ssd1306_IsDirty() && !ssd1306_IsBusy()) {
+			ssd1306_UpdateScreenAsync();
+		}
+		if (currentState == game && (hintFlag || heatMapFlag) && isHumanToMove()) {
+			if (HintStep(playerFlag ? firstPlayerChar : secondPlayerChar)) {
+				isNeedToUpdate = true;
+			}
 		}
 		HAL_UART_Receive_IT(&huart2, &uart_rx_buffer, 1);
 		/* USER CODE END WHILE */
@@ -832,17 +939,17 @@ static void MX_SPI1_Init(void) {
 	hspi1.Instance = SPI1;
 	hspi1.Init.Mode = SPI_MODE_MASTER;
 	hspi1.Init.Direction = SPI_DIRECTION_2LINES;
-	hspi1.Init.DataSize = SPI_DATASIZE_4BIT;
+	hspi1.Init.DataSize = SPI_DATASIZE_8BIT;
 	hspi1.Init.CLKPolarity = SPI_POLARITY_LOW;
 	hspi1.Init.CLKPhase = SPI_PHASE_1EDGE;
 	hspi1.Init.NSS = SPI_NSS_SOFT;
-	hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;
+	hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
 	hspi1.Init.FirstBit = SPI_FIRSTBIT_MSB;
 	hspi1.Init.TIMode = SPI_TIMODE_DISABLE;
 	hspi1.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
 	hspi1.Init.CRCPolynomial = 7;
 	hspi1.Init.CRCLength = SPI_CRC_LENGTH_DATASIZE;
-	hspi1.Init.NSSPMode = SPI_NSS_PULSE_ENABLE;
+	hspi1.Init.NSSPMode = SPI_NSS_PULSE_DISABLE;
 	if (HAL_SPI_Init(&hspi1) != HAL_OK) {
 		Error_Handler();
 	}
@@ -885,6 +992,24 @@ static void MX_USART2_UART_Init(void) {
 
 }
 
+/**
+ * Enable DMA controller clock
+ */
+static void MX_DMA_Init(void) {
+
+	/* DMA controller clock enable */
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	/* DMA interrupt init */
+	/* DMA1_Channel6_IRQn interrupt configuration */
+	HAL_NVIC_SetPriority(DMA1_Channel6_IRQn, 0, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Channel6_IRQn);
+	/* DMA1_Channel3_IRQn interrupt configuration */
+	HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 0, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+
+}
+
 /**
  * @brief GPIO Initialization Function
  * @param None
@@ -901,12 +1026,42 @@ static void MX_GPIO_Init(void) {
 	__HAL_RCC_GPIOA_CLK_ENABLE();
 	__HAL_RCC_GPIOB_CLK_ENABLE();
 
+	/*Configure GPIO pin Output Level */
+	HAL_GPIO_WritePin(OLED_DC_GPIO_Port, OLED_DC_Pin, GPIO_PIN_RESET);
+
+	/*Configure GPIO pin Output Level */
+	HAL_GPIO_WritePin(OLED_RESET_GPIO_Port, OLED_RESET_Pin, GPIO_PIN_SET);
+
+	/*Configure GPIO pin Output Level */
+	HAL_GPIO_WritePin(OLED_CS_GPIO_Port, OLED_CS_Pin, GPIO_PIN_SET);
+
 	/*Configure GPIO pin : B1_Pin */
 	GPIO_InitStruct.Pin = B1_Pin;
 	GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
 	GPIO_InitStruct.Pull = GPIO_NOPULL;
 	HAL_GPIO_Init(B1_GPIO_Port, &GPIO_InitStruct);
 
+	/*Configure GPIO pin : OLED_DC_Pin */
+	GPIO_InitStruct.Pin = OLED_DC_Pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	HAL_GPIO_Init(OLED_DC_GPIO_Port, &GPIO_InitStruct);
+
+	/*Configure GPIO pin : OLED_RESET_Pin */
+	GPIO_InitStruct.Pin = OLED_RESET_Pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	HAL_GPIO_Init(OLED_RESET_GPIO_Port, &GPIO_InitStruct);
+
+	/*Configure GPIO pin : OLED_CS_Pin */
+	GPIO_InitStruct.Pin = OLED_CS_Pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	HAL_GPIO_Init(OLED_CS_GPIO_Port, &GPIO_InitStruct);
+
 	/* EXTI interrupt init*/
 	HAL_NVIC_SetPriority(EXTI15_10_IRQn, 0, 0);
 	HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
@@ -10,8 +10,81 @@
  * and the decision-making process for the computer player.
  */
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "minimax.h"
 #include "winChecks.h"
+#include "proofNumber.h"
+#include "evaluation.h"
+#include "engine.h"
+
+#define winScore 1000 /**< Score of a won position, before the depth adjustment. Larger than any evaluation */
+#define infiniteScore 10000 /**< Bound larger than any score the search can return */
+
+/**
+ * @brief Move groups used for move ordering, searched from the highest to the lowest.
+ */
+enum moveClasses {
+	quietMove, nearMove, threatMove,
+};
+
+/**
+ * @brief State shared by all nodes of one search.
+ */
+typedef struct {
+	bool isSelective; /**< True if extensions and reductions are used, false for an exhaustive search */
+	int extensionsLeft; /**< Number of threat extensions the search may still apply */
+	unsigned long nodes; /**< Number of nodes visited */
+	const volatile uint32_t *cancelVersion; /**< Counter whose change cancels the search, or NULL */
+	uint32_t version; /**< Value of '*cancelVersion' when the search started */
+	unsigned long nodeLimit; /**< Number of nodes after which the search is cancelled, 0 for no limit */
+	bool isCancelled; /**< True once the search noticed the cancellation; its scores are then invalid */
+	uint8_t emptyCells[maxFieldSize * maxFieldSize]; /**< The empty cells of the board (row * maxFieldSize + column), unordered */
+	uint8_t emptySlot[maxFieldSize * maxFieldSize]; /**< Index of every empty cell in 'emptyCells' */
+	uint8_t emptyCount; /**< Number of empty cells */
+} SearchState;
+
+/**
+ * @brief Kinds of scores stored in the transposition table.
+ */
+enum boundTypes {
+	exactBound, lowerBound, upperBound,
+};
+
+/**
+ * @brief One entry of the transposition table.
+ */
+typedef struct {
+	uint32_t key; /**< Hash of the position, 0 for an empty entry */
+	int16_t score; /**< Score of the position */
+	uint8_t depth; /**< Remaining depth the score was searched with */
+	uint8_t bound; /**< Whether 'score' is exact, a lower bound or an upper bound */
+} TranspositionEntry;
+
+/**
+ * @brief Transposition table shared by all root moves of one search.
+ */
+static TranspositionEntry transpositions[TT_SIZE];
+
+/**
+ * @brief Random keys of every piece on every cell, used to hash positions (Zobrist hashing).
+ */
+static uint32_t pieceKeys[2][maxFieldSize * maxFieldSize];
+
+/**
+ * @brief Number of root searches started so far, used to notice that another search reused the table.
+ */
+static uint32_t transpositionOwner;
+
+/**
+ * @brief Number of nodes visited by the last root search.
+ */
+static unsigned long lastNodeCount;
+
+/**
+ * @brief Statistics of the last move chosen by the Minimax engine.
+ */
+static EngineStats lastMoveStats;
 
 /**
  * @brief Retrieves all available moves for the current player.
@@ -39,6 +112,277 @@ void GetAvailableMoves(char board[maxFieldSize][maxFieldSize], int size,
 	}
 }
 
+/**
+ * @brief Fills the empty-cell list of a search from the board.
+ *
+ * @param state The state of the search.
+ * @param board The current game board.
+ * @param size The size of the game board.
+ */
+static void InitEmptyCells(SearchState *state, char board[maxFieldSize][maxFieldSize], int size) {
+	state->emptyCount = 0;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (board[i][j] == '\0') {
+				int cell = i * maxFieldSize + j;
+				state->emptySlot[cell] = state->emptyCount;
+				state->emptyCells[state->emptyCount++] = cell;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Places a piece and removes its cell from the empty-cell list.
+ *
+ * The cell swaps places with the last empty cell, so the list shrinks by one at its end. Moves are
+ * taken back in reverse order, so the removed cell is still right behind the end of the list when
+ * 'UnmakeMove()' grows it again.
+ *
+ * @param state The state of the search.
+ * @param board The current game board.
+ * @param cell The empty cell (row * maxFieldSize + column).
+ * @param player The character of the player who moves.
+ */
+static inline void MakeMove(SearchState *state, char board[maxFieldSize][maxFieldSize], int cell, char player) {
+	int slot = state->emptySlot[cell];
+	int last = state->emptyCells[--state->emptyCount];
+	state->emptyCells[slot] = last;
+	state->emptySlot[last] = slot;
+	state->emptyCells[state->emptyCount] = cell;
+	state->emptySlot[cell] = state->emptyCount;
+	(&board[0][0])[cell] = player;
+}
+
+/**
+ * @brief Takes back the last move made with 'MakeMove()'.
+ *
+ * @param state The state of the search.
+ * @param board The current game board.
+ * @param cell The cell of the move.
+ */
+static inline void UnmakeMove(SearchState *state, char board[maxFieldSize][maxFieldSize], int cell) {
+	state->emptyCount++;
+	(&board[0][0])[cell] = '\0';
+}
+
+/**
+ * @brief Checks whether a move creates or answers a threat.
+ *
+ * A threat is a window that holds 'toWin - 1' pieces of one player and one empty cell. The move creates
+ * a threat if one of the windows through its cell now holds 'toWin - 1' pieces of the mover and nothing
+ * else, and it answers a threat if it took the last empty cell of a window held by the opponent.
+ *
+ * @param board The current game board, with the move already placed.
+ * @param mode The pattern tables of the current board size.
+ * @param cell The cell of the move (row * maxFieldSize + column).
+ * @param player The character of the player who made the move.
+ * @return True if the move creates or answers a threat, false otherwise.
+ */
+static bool IsThreatMove(char board[maxFieldSize][maxFieldSize], const EvalMode *mode, int cell,
+		char player) {
+	char opponent = player == firstPlayerChar ? secondPlayerChar : firstPlayerChar;
+	const char *cells = &board[0][0];
+	for (int k = mode->cellWindowStart[cell]; k < mode->cellWindowStart[cell + 1]; k++) {
+		const uint8_t *window = &mode->windowCells[mode->cellWindows[k] * mode->toWin];
+		int own = 0, other = 0;
+		for (int i = 0; i < mode->toWin; i++) {
+			own += cells[window[i]] == player;
+			other += cells[window[i]] == opponent;
+		}
+		if ((own == mode->toWin - 1 && other == 0) || (own == 1 && other == mode->toWin - 1))
+			return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Checks whether any of the eight neighbours of a cell is occupied.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param x The row of the cell.
+ * @param y The column of the cell.
+ * @return True if the cell touches at least one piece, false otherwise.
+ */
+static bool HasNeighbour(char board[maxFieldSize][maxFieldSize], int size, int x, int y) {
+	for (int i = max(x - 1, 0); i <= min(x + 1, size - 1); i++) {
+		for (int j = max(y - 1, 0); j <= min(y + 1, size - 1); j++) {
+			if (board[i][j] != '\0')
+				return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Orders the available moves so that the most forcing ones are searched first.
+ *
+ * Moves that create or answer a threat come first, then moves next to an existing piece, then all
+ * remaining moves. Within each group the moves are sorted in row-major order, independent of the order
+ * of the input. The 'moveClass' array receives, for every move in the new order, its group:
+ * 'threatMove', 'nearMove' or 'quietMove'.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param moves The cells of the available moves (row * maxFieldSize + column), reordered in place.
+ * @param moveCount The number of available moves.
+ * @param player The character of the player to move.
+ * @param moveClass Receives the group of every move.
+ */
+static void OrderMoves(char board[maxFieldSize][maxFieldSize], int size, uint8_t moves[], int moveCount,
+		char player, uint8_t moveClass[]) {
+	const EvalMode *mode = &evalModes[size - 3];
+	char *cells = &board[0][0];
+
+	for (int i = 0; i < moveCount; i++) {
+		int cell = moves[i];
+		cells[cell] = player;
+		bool threat = IsThreatMove(board, mode, cell, player);
+		cells[cell] = '\0';
+		moveClass[i] = threat ? threatMove :
+				(HasNeighbour(board, size, cell / maxFieldSize, cell % maxFieldSize) ? nearMove : quietMove);
+	}
+
+	for (int i = 1; i < moveCount; i++) {
+		uint8_t key = moveClass[i], cell = moves[i];
+		int j = i - 1;
+		for (; j >= 0 && (moveClass[j] < key || (moveClass[j] == key && moves[j] > cell)); j--) {
+			moveClass[j + 1] = moveClass[j];
+			moves[j + 1] = moves[j];
+		}
+		moveClass[j + 1] = key;
+		moves[j + 1] = cell;
+	}
+}
+
+/**
+ * @brief Searches a position with alpha-beta pruning; declared here because 'HorizonScore()' and
+ * 'SearchMove()' recurse into it. See its definition below.
+ */
+static int Minimax(SearchState *state, char board[maxFieldSize][maxFieldSize], int size, int depth,
+		bool isMaximizing, int alpha, int beta);
+
+/**
+ * @brief Scores a position at the search horizon, extending the search along threats.
+ *
+ * A static evaluation cannot see that a line one piece short of a win decides the game on the next
+ * move. So, while the extension budget lasts, threats are resolved first: if the side to move has a
+ * threat it wins on its next move, if the opponent has two threats on different cells they cannot both
+ * be blocked, and if the opponent has exactly one threat the only sensible move is to block it, so that
+ * move is searched one ply deeper. Only quiet positions are scored by the static evaluation.
+ *
+ * @param state The state of the current search.
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param isMaximizing A flag indicating whether the computer is to move.
+ * @param alpha The best score found so far for the maximizing player.
+ * @param beta The best score found so far for the minimizing player.
+ * @return The score of the position.
+ */
+static int HorizonScore(SearchState *state, char board[maxFieldSize][maxFieldSize], int size,
+		bool isMaximizing, int alpha, int beta) {
+	if (!state->isSelective || state->extensionsLeft <= 0)
+		return EvaluateBoard(board, size);
+
+	char player = isMaximizing ? secondPlayerChar : firstPlayerChar;
+	char opponent = isMaximizing ? firstPlayerChar : secondPlayerChar;
+	int sign = isMaximizing ? 1 : -1;
+	int threatCells[2];
+
+	if (FindThreats(board, size, player, threatCells) > 0)
+		return sign * (winScore - 1);
+
+	int opponentThreats = FindThreats(board, size, opponent, threatCells);
+	if (opponentThreats >= 2)
+		return -sign * (winScore - 2);
+	if (opponentThreats == 0)
+		return EvaluateBoard(board, size);
+
+	state->extensionsLeft--;
+	MakeMove(state, board, threatCells[0], player);
+	int score = Minimax(state, board, size, 0, !isMaximizing, alpha, beta);
+	UnmakeMove(state, board, threatCells[0]);
+
+	return score;
+}
+
+/**
+ * @brief Searches the child reached by a move, with late move reductions.
+ *
+ * Moves that neither create nor answer a threat are searched 'LATE_MOVE_REDUCTION' plies shallower
+ * once 'LATE_MOVE_INDEX' moves of the ordered list have been searched. Such a move is expected to be
+ * worse than the ones before it; if the reduced search shows that it improves on the best score of the
+ * mover anyway, it is searched again at the full depth. A move is only reduced if the full reduction
+ * fits into the remaining depth: with the default of two plies, the reduced child still reaches the
+ * horizon with the same side to move as its siblings, so their scores stay comparable. When the search
+ * reaches the end of the game anyway, as on 3x3, no move is reduced to keep the search exhaustive.
+ *
+ * @param state The state of the current search.
+ * @param board The current game board, with the move already placed.
+ * @param size The size of the game board.
+ * @param depth The remaining depth of the current node.
+ * @param moveIndex The index of the move in the ordered move list.
+ * @param moveClass The group of the move, as returned by 'OrderMoves()'.
+ * @param isMaximizing A flag indicating whether the computer made the move.
+ * @param alpha The best score found so far for the maximizing player.
+ * @param beta The best score found so far for the minimizing player.
+ * @return The score of the child node.
+ */
+static int SearchMove(SearchState *state, char board[maxFieldSize][maxFieldSize], int size, int depth,
+		int moveIndex, uint8_t moveClass, bool isMaximizing, int alpha, int beta) {
+	int reduction = 0;
+	if (state->isSelective && moveClass != threatMove && moveIndex >= LATE_MOVE_INDEX)
+		reduction = depth > LATE_MOVE_REDUCTION ? LATE_MOVE_REDUCTION : 0;
+
+	int score = Minimax(state, board, size, depth - 1 - reduction, !isMaximizing, alpha, beta);
+	if (reduction > 0 && (isMaximizing ? score > alpha : score < beta))
+		score = Minimax(state, board, size, depth - 1, !isMaximizing, alpha, beta);
+
+	return score;
+}
+
+/**
+ * @brief Empties the transposition table and creates the hash keys on first use.
+ *
+ * The keys come from a fixed xorshift sequence, so searches are reproducible.
+ */
+static void ClearTranspositions(void) {
+	if (pieceKeys[0][0] == 0) {
+		uint32_t random = 2463534242u;
+		for (int piece = 0; piece < 2; piece++) {
+			for (int cell = 0; cell < maxFieldSize * maxFieldSize; cell++) {
+				random ^= random << 13;
+				random ^= random >> 17;
+				random ^= random << 5;
+				pieceKeys[piece][cell] = random;
+			}
+		}
+	}
+	for (int i = 0; i < TT_SIZE; i++)
+		transpositions[i].key = 0;
+}
+
+/**
+ * @brief Computes the hash of a position.
+ *
+ * The side to move is not part of the hash: within one search it follows from the number of pieces.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @return The hash of the position, never 0.
+ */
+static uint32_t HashBoard(char board[maxFieldSize][maxFieldSize], int size) {
+	uint32_t key = 1;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (board[i][j] != '\0')
+				key ^= pieceKeys[board[i][j] == secondPlayerChar][i * maxFieldSize + j];
+		}
+	}
+	return key != 0 ? key : 1;
+}
+
 /**
  * @brief The Minimax algorithm for evaluating the best move.
  *
@@ -49,6 +393,18 @@ void GetAvailableMoves(char board[maxFieldSize][maxFieldSize], int size,
  * The 'isMaximizing' parameter indicates whether the current turn is for the computer (maximizing) 
  * or the player (minimizing). The function returns a score based on the best move found.
  *
+ * Terminal scores are adjusted by the remaining depth, so that a win found closer to the root scores
+ * higher than a later one, and a loss found closer to the root scores lower than a later one.
+ * When the maximum depth is reached before the game is decided, the position is scored by
+ * 'HorizonScore()', which extends the search along threats before falling back to the table-driven
+ * static evaluation. Positions already searched to the same depth are looked up in the transposition
+ * table instead of being searched again. The moves are taken from the empty-cell list of the search
+ * state instead of scanning the board, and are searched in the order given by 'OrderMoves()', with late moves
+ * reduced by 'SearchMove()'. One ply above the horizon, if the static evaluation is so far from the
+ * best score found so far that no quiet move can close the gap ('FUTILITY_MARGIN'), only the moves
+ * that create or answer a threat are searched.
+ *
+ * @param state The state of the current search.
  * @param board The current game board.
  * @param size The size of the game board.
  * @param depth The current search depth in the recursion.
@@ -57,92 +413,292 @@ void GetAvailableMoves(char board[maxFieldSize][maxFieldSize], int size,
  * @param beta The best score found so far for the minimizing player.
  * @return The best score for the current state.
  */
-int Minimax(char board[maxFieldSize][maxFieldSize], int size, int depth,
+static int Minimax(SearchState *state, char board[maxFieldSize][maxFieldSize], int size, int depth,
 		bool isMaximizing, int alpha, int beta) {
+	state->nodes++;
+	if ((state->cancelVersion != NULL && *state->cancelVersion != state->version)
+			|| (state->nodeLimit != 0 && state->nodes > state->nodeLimit))
+		state->isCancelled = true;
+	if (state->isCancelled)
+		return 0;
 	char gameStatus = checkWin(board, size);
-	int score;
-	if (gameStatus == secondPlayerChar) {
-		score = 10;
-	} else if (gameStatus == firstPlayerChar) {
-		score = -10;
-	} else {
-		score = 0;
+	if (gameStatus == secondPlayerChar)
+		return winScore + depth;
+	if (gameStatus == firstPlayerChar)
+		return -winScore - depth;
+	if (gameStatus == 'd')
+		return 0;
+	if (depth == 0)
+		return HorizonScore(state, board, size, isMaximizing, alpha, beta);
+
+	uint32_t key = HashBoard(board, size);
+	TranspositionEntry *entry = &transpositions[key & (TT_SIZE - 1)];
+	if (entry->key == key && entry->depth == depth) {
+		if (entry->bound == exactBound || (entry->bound == lowerBound && entry->score >= beta)
+				|| (entry->bound == upperBound && entry->score <= alpha))
+			return entry->score;
 	}
+	int originalAlpha = alpha, originalBeta = beta;
 
-	if (score == 10 || score == -10)
-		return score - depth;
-	if (depth == 0 || isDraw(board, size))
-		return 0;
+	int moveCount = state->emptyCount;
+	uint8_t moves[maxFieldSize * maxFieldSize], moveClass[maxFieldSize * maxFieldSize];
+	for (int i = 0; i < moveCount; i++)
+		moves[i] = state->emptyCells[i];
+	OrderMoves(board, size, moves, moveCount, isMaximizing ? secondPlayerChar : firstPlayerChar, moveClass);
 
-	int moves[maxFieldSize * maxFieldSize][2], moveCount;
-	GetAvailableMoves(board, size, moves, &moveCount);
+	bool isFutile = false;
+	int staticScore = 0;
+	if (state->isSelective && depth == 1) {
+		staticScore = EvaluateBoard(board, size);
+		isFutile = isMaximizing ? staticScore + FUTILITY_MARGIN <= alpha : staticScore - FUTILITY_MARGIN >= beta;
+	}
 
+	int bestScore;
 	if (isMaximizing) {
-		int bestScore = -1000;
+		bestScore = -infiniteScore;
 		for (int i = 0; i < moveCount; i++) {
-			int x = moves[i][0], y = moves[i][1];
-			board[x][y] = secondPlayerChar;
+			if (isFutile && moveClass[i] != threatMove) {
+				bestScore = max(bestScore, staticScore);
+				break;
+			}
+			MakeMove(state, board, moves[i], secondPlayerChar);
 			bestScore = max(bestScore,
-					Minimax(board, size, depth - 1, false, alpha, beta));
-			board[x][y] = '\0';
+					SearchMove(state, board, size, depth, i, moveClass[i], true, alpha, beta));
+			UnmakeMove(state, board, moves[i]);
 
 			alpha = max(alpha, bestScore);
 			if (beta <= alpha)
 				break;
 		}
-		return bestScore;
 	} else {
-		int bestScore = 1000;
+		bestScore = infiniteScore;
 		for (int i = 0; i < moveCount; i++) {
-			int x = moves[i][0], y = moves[i][1];
-			board[x][y] = firstPlayerChar;
+			if (isFutile && moveClass[i] != threatMove) {
+				bestScore = min(bestScore, staticScore);
+				break;
+			}
+			MakeMove(state, board, moves[i], firstPlayerChar);
 			bestScore = min(bestScore,
-					Minimax(board, size, depth - 1, true, alpha, beta));
-			board[x][y] = '\0';
+					SearchMove(state, board, size, depth, i, moveClass[i], false, alpha, beta));
+			UnmakeMove(state, board, moves[i]);
 
 			beta = min(beta, bestScore);
 			if (beta <= alpha)
 				break;
 		}
+	}
+
+	if (state->isCancelled)
 		return bestScore;
+	entry->key = key;
+	entry->score = bestScore;
+	entry->depth = depth;
+	entry->bound = bestScore <= originalAlpha ? upperBound : (bestScore >= originalBeta ? lowerBound : exactBound);
+	return bestScore;
+}
+
+void AnalysisStart(Analysis *analysis, char board[maxFieldSize][maxFieldSize], int size, char toMove,
+		const volatile uint32_t *cancelVersion) {
+	analysis->cancelVersion = cancelVersion;
+	analysis->version = cancelVersion != NULL ? *cancelVersion : 0;
+	for (int i = 0; i < maxFieldSize; i++) {
+		for (int j = 0; j < maxFieldSize; j++) {
+			char cell = board[i][j];
+			if (toMove == firstPlayerChar && cell != '\0')
+				cell = cell == firstPlayerChar ? secondPlayerChar : firstPlayerChar;
+			analysis->board[i][j] = cell;
+			analysis->scores[i][j] = noScore;
+		}
+	}
+
+	analysis->size = size;
+	analysis->nextMove = 0;
+	analysis->nodes = 0;
+	analysis->extensionsLeft = EXTENSION_BUDGET;
+	GetAvailableMoves(analysis->board, size, analysis->moves, &analysis->moveCount);
+	analysis->maxDepth = (size <= 3) ? 9 : (size <= 4 ? 4 : 3);
+	analysis->nodeLimit = 0;
+	analysis->owner = ++transpositionOwner;
+	ClearTranspositions();
+}
+
+AnalysisStatus AnalysisStep(Analysis *analysis) {
+	if (analysis->cancelVersion != NULL && *analysis->cancelVersion != analysis->version)
+		return analysisCancelled;
+	if (analysis->nextMove >= analysis->moveCount)
+		return analysisDone;
+	if (analysis->nodeLimit != 0 && analysis->nodes >= analysis->nodeLimit)
+		return analysisCancelled;
+
+	if (analysis->owner != transpositionOwner) {
+		analysis->owner = ++transpositionOwner;
+		ClearTranspositions();
+	}
+
+	SearchState state = {
+		.isSelective = analysis->maxDepth < analysis->moveCount - 1,
+		.extensionsLeft = analysis->extensionsLeft,
+		.cancelVersion = analysis->cancelVersion,
+		.version = analysis->version,
+		.nodeLimit = analysis->nodeLimit != 0 ? analysis->nodeLimit - analysis->nodes : 0,
+	};
+	int x = analysis->moves[analysis->nextMove][0], y = analysis->moves[analysis->nextMove][1];
+	InitEmptyCells(&state, analysis->board, analysis->size);
+	MakeMove(&state, analysis->board, x * maxFieldSize + y, secondPlayerChar);
+	int score = Minimax(&state, analysis->board, analysis->size, analysis->maxDepth, false, -infiniteScore,
+			infiniteScore);
+	UnmakeMove(&state, analysis->board, x * maxFieldSize + y);
+
+	analysis->nodes += state.nodes;
+	analysis->extensionsLeft = state.extensionsLeft;
+	lastNodeCount = analysis->nodes;
+	if (state.isCancelled)
+		return analysisCancelled;
+
+	analysis->scores[x][y] = score;
+	analysis->nextMove++;
+	return analysis->nextMove < analysis->moveCount ? analysisRunning : analysisDone;
+}
+
+void AnalyseMoves(char board[maxFieldSize][maxFieldSize], int size, char toMove,
+		int scores[maxFieldSize][maxFieldSize]) {
+	Analysis analysis;
+	AnalysisStart(&analysis, board, size, toMove, NULL);
+	while (AnalysisStep(&analysis) == analysisRunning)
+		;
+
+	for (int i = 0; i < maxFieldSize; i++) {
+		for (int j = 0; j < maxFieldSize; j++)
+			scores[i][j] = analysis.scores[i][j];
 	}
 }
 
 /**
- * @brief Makes the computer's move based on the best possible choice.
+ * @brief Chooses the computer's move within a search budget.
  *
- * This function calculates the best possible move for the computer player using the Minimax algorithm
- * and then makes the move on the game board. The computer always tries to maximize its chances of winning.
- * 
- * The 'maxDepth' is determined based on the size of the game board (larger boards may have a smaller depth 
- * for optimization reasons).
+ * Before the Minimax search, a bounded proof-number search checks whether the computer has a forced win.
+ * If it does, the first move of the shortest proven win is chosen right away. Otherwise all moves are
+ * scored by the incremental analysis and the first one with the highest score is chosen.
  *
- * @param board The current game board.
+ * Without a node budget, the moves are searched once to the full depth. With a node budget, the search
+ * deepens one ply at a time, starting from a depth of one, and the move of the deepest completed
+ * iteration is chosen. The transposition table is cleared for every iteration, so the iteration of a
+ * given depth searches the same nodes as a search limited to that depth. The proof-number check is bounded
+ * by its own pool and runs as it does without a budget; its nodes are reported in the statistics but do
+ * not count against the budget. A budget at least as large as the nodes of a depth-limited search thus
+ * completes the iteration of that depth, as the check costs more nodes than the shallower iterations.
+ * If the budget runs out before the first iteration completes, the best move scored so far is chosen,
+ * or the first move in search order if none was scored, so a move is chosen whenever one is legal.
+ *
+ * @param board The current game board, with the computer to move.
  * @param size The size of the game board.
+ * @param budget The search budget.
+ * @param row Receives the row of the chosen move.
+ * @param column Receives the column of the chosen move.
+ * @return True if a move was chosen, false if the board is full.
  */
-void ComputerMove(char board[maxFieldSize][maxFieldSize], int size) {
-	int bestScore = -1000;
-	int bestMove[2] = { -1, -1 };
+static bool MinimaxSearch(char board[maxFieldSize][maxFieldSize], int size, const EngineBudget *budget, int *row,
+		int *column) {
+	lastMoveStats.depth = 0;
+	PnResult proof = ProofNumberSolve(board, size, secondPlayerChar, row, column);
+	unsigned long proofNodes = ProofNumberNodeCount();
+	lastMoveStats.nodes = proofNodes;
+	if (proof == pnProvenWin)
+		return true;
 
-	int moves[maxFieldSize * maxFieldSize][2], moveCount;
-	GetAvailableMoves(board, size, moves, &moveCount);
+	Analysis analysis;
+	AnalysisStart(&analysis, board, size, secondPlayerChar, NULL);
+	int maxDepth = budget->maxDepth > 0 ? budget->maxDepth : analysis.maxDepth;
+	int bestMove[2] = { -1, -1 };
 
-	int maxDepth = (size <= 3) ? 9 : (size <= 4 ? 4 : 3);
+	unsigned long searchNodes = 0;
+	for (int depth = budget->maxNodes != 0 ? 1 : maxDepth; depth <= maxDepth; depth++) {
+		if (budget->maxNodes != 0 && searchNodes >= budget->maxNodes)
+			break;
+		if (depth > 1 && budget->maxNodes != 0)
+			AnalysisStart(&analysis, board, size, secondPlayerChar, NULL);
+		analysis.maxDepth = depth;
+		analysis.nodeLimit = budget->maxNodes != 0 ? budget->maxNodes - searchNodes : 0;
 
-	for (int i = 0; i < moveCount; i++) {
-		int x = moves[i][0], y = moves[i][1];
-		board[x][y] = secondPlayerChar;
+		AnalysisStatus status;
+		while ((status = AnalysisStep(&analysis)) == analysisRunning)
+			;
+		searchNodes += analysis.nodes;
+		if (status != analysisDone || analysis.moveCount == 0)
+			break;
 
-		int moveScore = Minimax(board, size, maxDepth, false, -1000, 1000);
-
-		board[x][y] = '\0';
+		int bestScore = -infiniteScore;
+		for (int i = 0; i < analysis.moveCount; i++) {
+			int x = analysis.moves[i][0], y = analysis.moves[i][1];
+			if (analysis.scores[x][y] > bestScore) {
+				bestScore = analysis.scores[x][y];
+				bestMove[0] = x;
+				bestMove[1] = y;
+			}
+		}
+		lastMoveStats.depth = depth;
+	}
 
-		if (moveScore > bestScore) {
-			bestScore = moveScore;
-			bestMove[0] = x;
-			bestMove[1] = y;
+	if (bestMove[0] < 0 && analysis.moveCount > 0) {
+		// No iteration completed: the moves scored so far are those of the first iteration
+		int bestScore = -infiniteScore;
+		for (int i = 0; i < analysis.nextMove; i++) {
+			int x = analysis.moves[i][0], y = analysis.moves[i][1];
+			if (analysis.scores[x][y] > bestScore) {
+				bestScore = analysis.scores[x][y];
+				bestMove[0] = x;
+				bestMove[1] = y;
+			}
+		}
+		if (bestMove[0] < 0) {
+			uint8_t moves[maxFieldSize * maxFieldSize], moveClass[maxFieldSize * maxFieldSize];
+			for (int i = 0; i < analysis.moveCount; i++)
+				moves[i] = analysis.moves[i][0] * maxFieldSize + analysis.moves[i][1];
+			OrderMoves(analysis.board, size, moves, analysis.moveCount, secondPlayerChar, moveClass);
+			bestMove[0] = moves[0] / maxFieldSize;
+			bestMove[1] = moves[0] % maxFieldSize;
 		}
 	}
 
-	board[bestMove[0]][bestMove[1]] = secondPlayerChar;
+	lastNodeCount = searchNodes;
+	lastMoveStats.nodes = proofNodes + searchNodes;
+	*row = bestMove[0];
+	*column = bestMove[1];
+	return bestMove[0] >= 0;
+}
+
+/**
+ * @brief Writes the statistics of the last move chosen by the Minimax engine.
+ *
+ * @param stats Receives the statistics.
+ */
+static void MinimaxStats(EngineStats *stats) {
+	*stats = lastMoveStats;
+}
+
+const Engine minimaxEngine = {
+	.name = "minimax",
+	.sizes = engineSize(3) | engineSize(4) | engineSize(5),
+	.search = MinimaxSearch,
+	.stats = MinimaxStats,
+};
+
+/**
+ * @brief Makes the computer's move based on the best possible choice.
+ *
+ * This function calculates the best possible move for the computer player with the Minimax engine
+ * and its default budget, and then makes the move on the game board.
+ *
+ * @param board The current game board.
+ * @param size The size of the game board.
+ */
+void ComputerMove(char board[maxFieldSize][maxFieldSize], int size) {
+	static const EngineBudget defaultBudget = { 0 };
+	int row, column;
+	if (MinimaxSearch(board, size, &defaultBudget, &row, &column))
+		board[row][column] = secondPlayerChar;
+}
+
+unsigned long MinimaxNodeCount(void) {
+	return lastNodeCount;
 }
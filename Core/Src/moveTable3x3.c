@@ -0,0 +1,831 @@
+/**
+ * @file moveTable3x3.c
+ * @brief Perfect-play move table of the 3x3 table engine.
+ *
+ * This file is generated by Tools/genMoveTable.c. Do not edit it by hand.
+ */
+#include <stdint.h>
+
+const uint8_t moveTable3x3[19683] = {
+	0, 1, 4, 0, 2, 3, 0, 3, 2, 0, 1, 5, 0, 255, 4, 4, 4, 5, 4, 3, 1, 4, 4, 4,
+	0, 3, 255, 0, 6, 1, 0, 2, 4, 0, 6, 2, 0, 1, 4, 0, 255, 4, 4, 6, 4, 0, 6, 1,
+	4, 6, 4, 0, 6, 255, 0, 1, 6, 0, 2, 6, 0, 4, 2, 0, 1, 6, 0, 255, 6, 8, 4, 6,
+	0, 4, 1, 4, 4, 6, 0, 4, 255, 0, 8, 1, 7, 2, 7, 0, 8, 2, 6, 1, 6, 0, 255, 6,
+	6, 6, 6, 0, 8, 1, 7, 7, 7, 0, 8, 255, 5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 1, 5,
+	0, 255, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 255, 0, 8, 6, 7, 2, 7, 0, 8, 2,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 0, 8, 1, 7, 7, 7, 0, 8, 255, 0, 1, 8, 0, 2, 8,
+	7, 7, 2, 0, 1, 8, 0, 255, 8, 7, 7, 3, 6, 6, 1, 6, 6, 3, 0, 3, 255, 0, 6, 8,
+	0, 2, 8, 7, 6, 2, 0, 1, 8, 0, 255, 8, 7, 6, 5, 6, 6, 1, 6, 6, 5, 0, 6, 255,
+	5, 5, 1, 5, 2, 2, 0, 2, 2, 5, 1, 1, 0, 255, 5, 0, 5, 5, 0, 1, 1, 0, 5, 5,
+	0, 5, 255, 0, 2, 2, 2, 2, 4, 2, 3, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 0, 3, 1,
+	4, 3, 4, 0, 3, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 255, 0, 2, 6, 2, 2, 6, 0, 8, 2, 8, 1, 8, 0, 255, 8,
+	8, 8, 8, 0, 1, 1, 0, 4, 6, 0, 4, 255, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 1, 3,
+	0, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 8, 6, 7, 2, 7,
+	2, 8, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 0, 8, 1, 7, 7, 7, 0, 8, 255, 0, 2, 8,
+	2, 2, 8, 7, 7, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 6, 6, 1, 6, 6, 3, 0, 3, 255,
+	0, 6, 8, 0, 2, 8, 7, 6, 2, 8, 1, 8, 0, 255, 8, 8, 6, 8, 6, 6, 1, 6, 6, 6,
+	0, 6, 255, 0, 2, 1, 2, 2, 2, 7, 7, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 6, 6, 1,
+	6, 6, 6, 0, 6, 255, 2, 2, 1, 2, 2, 4, 0, 6, 2, 0, 1, 3, 0, 255, 4, 3, 4, 4,
+	8, 8, 1, 8, 8, 8, 0, 8, 255, 0, 6, 2, 0, 2, 2, 2, 6, 2, 0, 1, 1, 0, 255, 4,
+	6, 6, 4, 8, 6, 1, 8, 6, 8, 0, 6, 255, 4, 4, 1, 4, 2, 2, 4, 4, 2, 4, 1, 1,
+	0, 255, 4, 4, 4, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255, 0, 8, 1, 7, 2, 7, 0, 8, 2,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 8, 8, 1, 7, 7, 7, 0, 8, 255, 0, 6, 1, 7, 2, 7,
+	0, 6, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 8, 6, 1, 7, 6, 7, 0, 6, 255, 0, 8, 6,
+	7, 2, 7, 0, 8, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 8, 8, 1, 7, 7, 7, 0, 8, 255,
+	3, 3, 1, 3, 2, 2, 0, 2, 2, 3, 1, 1, 0, 255, 3, 0, 3, 3, 0, 1, 1, 0, 3, 3,
+	0, 3, 255, 0, 6, 8, 0, 2, 8, 7, 6, 2, 0, 1, 8, 0, 255, 8, 7, 6, 6, 0, 6, 1,
+	0, 6, 6, 0, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 2, 0, 2, 4, 0, 3, 2, 4, 1, 4, 0, 255, 4,
+	4, 3, 4, 0, 3, 1, 7, 3, 7, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 2, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 1, 0, 255, 4, 0, 255, 255, 4, 2, 7, 2, 2, 4, 8, 4, 2,
+	4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 8, 1, 7, 4, 7, 0, 8, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 1, 7, 3, 7, 0, 3, 255, 0, 255, 2,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 5, 0, 255, 5, 0, 255, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 8, 1, 7, 7, 7,
+	0, 8, 255, 0, 3, 8, 0, 2, 8, 7, 3, 2, 0, 1, 8, 0, 255, 8, 7, 3, 3, 0, 3, 1,
+	0, 3, 8, 0, 3, 255, 0, 255, 8, 0, 255, 8, 0, 255, 2, 0, 255, 8, 0, 255, 8, 0, 255, 5,
+	0, 255, 1, 0, 255, 8, 0, 255, 255, 5, 5, 1, 5, 2, 2, 0, 2, 2, 5, 1, 1, 0, 255, 5,
+	0, 5, 5, 5, 5, 1, 5, 5, 5, 0, 5, 255, 2, 3, 2, 0, 2, 2, 2, 3, 2, 4, 1, 4,
+	0, 255, 4, 4, 3, 4, 3, 3, 1, 3, 3, 4, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 0, 8, 1, 7, 4, 7, 0, 8, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 3, 3, 3, 3, 3, 3, 3, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 8, 1,
+	7, 7, 7, 0, 8, 255, 8, 3, 8, 0, 2, 8, 7, 3, 2, 8, 1, 8, 0, 255, 8, 8, 3, 8,
+	0, 3, 1, 0, 3, 8, 0, 3, 255, 0, 255, 8, 0, 255, 8, 0, 255, 2, 0, 255, 8, 0, 255, 8,
+	0, 255, 8, 0, 255, 1, 0, 255, 8, 0, 255, 255, 8, 2, 8, 2, 2, 8, 7, 7, 2, 8, 1, 8,
+	0, 255, 8, 8, 8, 8, 0, 1, 1, 0, 7, 8, 0, 7, 255, 0, 3, 8, 0, 2, 4, 0, 3, 2,
+	4, 1, 4, 0, 255, 4, 4, 3, 4, 8, 3, 1, 8, 3, 8, 0, 3, 255, 0, 255, 2, 0, 255, 4,
+	0, 255, 2, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 1, 0, 255, 8, 0, 255, 255, 4, 4, 4,
+	4, 2, 4, 4, 4, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 8, 3, 1, 7, 3, 7,
+	0, 3, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1,
+	0, 255, 7, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	8, 8, 1, 7, 7, 7, 0, 8, 255, 3, 3, 1, 3, 2, 2, 0, 3, 2, 3, 1, 1, 0, 255, 3,
+	0, 3, 3, 0, 3, 1, 0, 3, 3, 0, 3, 255, 0, 255, 8, 0, 255, 8, 0, 255, 2, 0, 255, 8,
+	0, 255, 8, 0, 255, 7, 0, 255, 1, 0, 255, 8, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 1, 3, 0, 2, 3,
+	0, 4, 2, 0, 1, 3, 0, 255, 3, 4, 8, 3, 4, 4, 1, 4, 4, 3, 0, 4, 255, 2, 4, 4,
+	4, 2, 4, 4, 4, 2, 5, 1, 5, 0, 255, 4, 5, 4, 5, 4, 4, 1, 4, 4, 4, 0, 4, 255,
+	0, 1, 255, 0, 2, 255, 0, 4, 255, 0, 1, 255, 0, 255, 255, 0, 8, 255, 0, 4, 255, 0, 4, 255,
+	0, 4, 255, 0, 8, 3, 7, 2, 7, 0, 8, 2, 0, 1, 3, 0, 255, 7, 5, 8, 3, 1, 8, 1,
+	7, 7, 7, 0, 8, 255, 5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 1, 5, 0, 255, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 255, 0, 8, 255, 7, 2, 255, 0, 8, 255, 0, 1, 255, 0, 255, 255,
+	0, 8, 255, 0, 8, 255, 7, 7, 255, 0, 8, 255, 2, 2, 1, 2, 2, 2, 0, 2, 2, 0, 1, 1,
+	0, 255, 3, 7, 7, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1, 2, 2, 2, 0, 2, 2,
+	0, 1, 8, 0, 255, 8, 7, 7, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255,
+	0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 8, 2, 3,
+	2, 2, 3, 4, 4, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 4, 4, 1, 4, 4, 3, 0, 4, 255,
+	4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 255, 0, 2, 255, 0, 2, 255, 0, 8, 255, 8, 1, 255, 0, 255, 255, 8, 8, 255, 0, 4, 255,
+	0, 4, 255, 0, 4, 255, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 1, 3, 0, 255, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 8, 255, 7, 2, 255, 0, 8, 255, 8, 1, 255,
+	0, 255, 255, 8, 8, 255, 0, 8, 255, 7, 7, 255, 0, 8, 255, 2, 2, 1, 2, 2, 2, 0, 2, 2,
+	8, 1, 8, 0, 255, 8, 8, 8, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1, 2, 2, 2,
+	0, 2, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 2, 255,
+	0, 2, 255, 0, 2, 255, 8, 1, 255, 0, 255, 255, 8, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 2, 3, 4, 2, 3, 0, 2, 2, 0, 1, 3, 0, 255, 3, 4, 4, 3, 0, 1, 1, 0, 3, 3,
+	0, 3, 255, 2, 2, 1, 2, 2, 4, 0, 2, 2, 0, 1, 4, 0, 255, 4, 4, 4, 4, 0, 1, 1,
+	0, 4, 4, 0, 4, 255, 0, 4, 255, 0, 2, 255, 0, 4, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255,
+	0, 1, 255, 0, 4, 255, 0, 4, 255, 1, 8, 3, 7, 2, 7, 2, 8, 2, 0, 1, 3, 0, 255, 7,
+	0, 8, 3, 8, 8, 1, 7, 7, 7, 0, 8, 255, 1, 8, 1, 7, 2, 7, 2, 8, 2, 0, 1, 1,
+	0, 255, 7, 0, 8, 7, 8, 8, 1, 7, 7, 7, 0, 8, 255, 0, 8, 255, 7, 2, 255, 0, 8, 255,
+	0, 1, 255, 0, 255, 255, 0, 8, 255, 0, 8, 255, 7, 7, 255, 0, 8, 255, 0, 1, 1, 0, 2, 2,
+	0, 2, 2, 3, 1, 1, 0, 255, 3, 0, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1,
+	2, 2, 2, 0, 2, 2, 0, 1, 8, 0, 255, 8, 7, 7, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 1, 6, 4, 2, 4, 0, 6, 2, 1, 1, 4, 0, 255, 4, 6, 4, 6, 8, 4, 1,
+	4, 4, 4, 0, 6, 255, 4, 6, 4, 4, 2, 4, 6, 6, 2, 0, 1, 4, 0, 255, 4, 4, 6, 4,
+	4, 6, 1, 4, 4, 4, 0, 6, 255, 4, 1, 6, 4, 2, 4, 0, 8, 2, 1, 1, 6, 0, 255, 4,
+	6, 4, 6, 4, 4, 1, 4, 4, 4, 0, 8, 255, 1, 1, 1, 255, 255, 255, 6, 8, 2, 1, 1, 1,
+	255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 8, 255, 1, 1, 1, 255, 255, 255, 5, 5, 5,
+	1, 1, 1, 255, 255, 255, 5, 5, 5, 1, 1, 1, 255, 255, 255, 5, 5, 255, 1, 1, 1, 255, 255, 255,
+	6, 8, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 8, 255, 0, 6, 8,
+	0, 2, 8, 0, 6, 2, 8, 1, 8, 0, 255, 8, 8, 6, 8, 6, 6, 1, 6, 6, 3, 0, 6, 255,
+	6, 6, 8, 0, 2, 8, 6, 6, 2, 0, 1, 8, 0, 255, 8, 6, 6, 8, 6, 6, 1, 6, 6, 5,
+	0, 6, 255, 5, 5, 1, 5, 2, 2, 5, 5, 2, 5, 1, 1, 0, 255, 5, 5, 5, 5, 0, 1, 1,
+	0, 5, 5, 0, 5, 255, 4, 1, 4, 4, 2, 4, 8, 3, 2, 8, 1, 8, 0, 255, 4, 8, 8, 8,
+	4, 3, 1, 4, 4, 4, 0, 3, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 255, 8, 1, 6, 4, 2, 4, 8, 8, 2, 8, 1, 8,
+	0, 255, 4, 8, 8, 8, 0, 4, 1, 4, 4, 4, 0, 8, 255, 1, 1, 1, 255, 255, 255, 3, 3, 3,
+	1, 1, 1, 255, 255, 255, 3, 3, 3, 1, 1, 1, 255, 255, 255, 3, 3, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1,
+	255, 255, 255, 2, 8, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 8, 255,
+	8, 2, 8, 2, 2, 8, 8, 6, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 6, 6, 1, 6, 6, 3,
+	0, 6, 255, 6, 6, 8, 0, 2, 8, 6, 6, 2, 8, 1, 8, 0, 255, 8, 8, 6, 8, 6, 6, 1,
+	6, 6, 6, 0, 6, 255, 8, 2, 1, 2, 2, 2, 8, 8, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8,
+	6, 6, 1, 6, 6, 6, 0, 6, 255, 4, 1, 4, 4, 2, 4, 0, 6, 2, 1, 1, 4, 0, 255, 4,
+	6, 4, 6, 8, 8, 1, 4, 4, 4, 0, 8, 255, 6, 6, 1, 4, 2, 4, 6, 6, 2, 0, 1, 4,
+	0, 255, 4, 6, 6, 6, 8, 6, 1, 4, 4, 4, 0, 6, 255, 4, 4, 1, 4, 2, 4, 4, 4, 2,
+	4, 1, 1, 0, 255, 4, 4, 4, 4, 0, 1, 1, 4, 4, 4, 0, 4, 255, 1, 1, 1, 255, 255, 255,
+	6, 8, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 8, 255, 1, 1, 1,
+	255, 255, 255, 0, 6, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 6, 255,
+	1, 1, 1, 255, 255, 255, 6, 8, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255,
+	0, 8, 255, 3, 3, 1, 3, 2, 2, 3, 3, 2, 3, 1, 1, 0, 255, 3, 3, 3, 3, 0, 1, 1,
+	0, 3, 3, 0, 3, 255, 6, 6, 8, 0, 2, 8, 6, 6, 2, 0, 1, 8, 0, 255, 8, 6, 6, 8,
+	0, 6, 1, 0, 6, 6, 0, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 8, 3, 8, 4, 2, 4, 8, 3, 8, 4, 1, 4,
+	0, 255, 4, 4, 3, 4, 8, 3, 8, 4, 3, 4, 8, 3, 255, 0, 255, 8, 0, 255, 4, 0, 255, 8,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 8, 0, 255, 4, 0, 255, 255, 8, 8, 8, 4, 2, 4,
+	8, 8, 8, 4, 1, 4, 0, 255, 4, 4, 4, 4, 8, 8, 8, 4, 4, 4, 8, 8, 255, 1, 1, 1,
+	255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 8, 3, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255,
+	0, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1,
+	255, 255, 255, 8, 8, 255, 8, 3, 8, 8, 2, 8, 8, 3, 8, 8, 1, 8, 0, 255, 8, 8, 3, 8,
+	8, 3, 8, 8, 3, 8, 8, 3, 255, 0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 8,
+	0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 255, 8, 8, 8, 8, 2, 8, 8, 8, 8, 8, 1, 8,
+	0, 255, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 255, 8, 3, 8, 4, 2, 4, 8, 3, 8,
+	4, 1, 4, 0, 255, 4, 4, 3, 4, 8, 3, 8, 4, 3, 4, 8, 3, 255, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 255, 8, 8, 8,
+	4, 2, 4, 8, 8, 8, 4, 1, 4, 0, 255, 4, 4, 4, 4, 8, 8, 8, 4, 4, 4, 8, 8, 255,
+	1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255,
+	3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	1, 1, 1, 255, 255, 255, 8, 8, 255, 8, 3, 8, 8, 2, 8, 8, 3, 8, 8, 1, 8, 0, 255, 8,
+	8, 3, 8, 8, 3, 8, 8, 3, 8, 8, 3, 255, 0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 8,
+	0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 255, 8, 8, 8, 8, 2, 8, 8, 8, 8,
+	8, 1, 8, 0, 255, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 255, 8, 3, 8, 4, 2, 4,
+	8, 3, 8, 4, 1, 4, 0, 255, 4, 4, 3, 4, 8, 3, 8, 4, 3, 4, 8, 3, 255, 0, 255, 8,
+	0, 255, 4, 0, 255, 8, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 8, 0, 255, 4, 0, 255, 255,
+	8, 8, 8, 4, 2, 4, 8, 8, 8, 4, 1, 4, 0, 255, 4, 4, 4, 4, 8, 8, 8, 4, 4, 4,
+	8, 8, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1,
+	255, 255, 255, 8, 3, 255, 0, 255, 1, 255, 255, 255, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 1, 1, 1, 255, 255, 255, 8, 8, 255, 8, 3, 8, 8, 2, 8, 8, 3, 8, 8, 1, 8,
+	0, 255, 8, 8, 3, 8, 8, 3, 8, 8, 3, 8, 8, 3, 255, 0, 255, 8, 0, 255, 8, 0, 255, 8,
+	0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 8, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 3,
+	4, 2, 4, 0, 2, 2, 1, 1, 3, 0, 255, 4, 0, 8, 3, 4, 4, 1, 4, 4, 4, 0, 4, 255,
+	4, 1, 4, 4, 2, 4, 0, 4, 2, 1, 1, 4, 0, 255, 4, 5, 4, 5, 4, 4, 1, 4, 4, 4,
+	0, 4, 255, 0, 1, 255, 4, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 8, 255, 0, 4, 255,
+	4, 4, 255, 0, 4, 255, 1, 1, 1, 255, 255, 255, 0, 8, 2, 1, 1, 1, 255, 255, 255, 5, 8, 3,
+	1, 1, 1, 255, 255, 255, 0, 8, 255, 1, 1, 1, 255, 255, 255, 5, 5, 5, 1, 1, 1, 255, 255, 255,
+	5, 5, 5, 1, 1, 1, 255, 255, 255, 5, 5, 255, 1, 1, 255, 255, 255, 255, 0, 8, 255, 1, 1, 255,
+	255, 255, 255, 0, 8, 255, 1, 1, 255, 255, 255, 255, 0, 8, 255, 2, 2, 1, 2, 2, 2, 2, 2, 2,
+	0, 1, 1, 0, 255, 3, 0, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1, 2, 2, 2,
+	2, 2, 2, 0, 1, 8, 0, 255, 8, 0, 5, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255,
+	0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	4, 1, 3, 4, 2, 4, 0, 4, 2, 8, 1, 8, 0, 255, 4, 8, 8, 8, 4, 4, 1, 4, 4, 4,
+	0, 4, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 255, 0, 1, 255, 4, 2, 255, 0, 8, 255, 8, 1, 255, 0, 255, 255, 8, 8, 255,
+	0, 4, 255, 4, 4, 255, 0, 4, 255, 1, 1, 1, 255, 255, 255, 3, 3, 3, 1, 1, 1, 255, 255, 255,
+	3, 3, 3, 1, 1, 1, 255, 255, 255, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 255, 255, 255, 255, 0, 8, 255,
+	1, 1, 255, 255, 255, 255, 8, 8, 255, 1, 1, 255, 255, 255, 255, 0, 8, 255, 2, 2, 1, 2, 2, 2,
+	2, 2, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1,
+	2, 2, 2, 2, 2, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 2, 255, 0, 2, 255, 0, 2, 255, 8, 1, 255, 0, 255, 255, 8, 8, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 4, 1, 3, 4, 2, 4, 0, 2, 2, 1, 1, 3, 0, 255, 4, 0, 3, 3, 0, 1, 1,
+	4, 4, 4, 0, 3, 255, 1, 1, 2, 4, 2, 4, 2, 2, 2, 1, 1, 1, 0, 255, 4, 0, 4, 4,
+	0, 1, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255, 4, 2, 255, 0, 4, 255, 0, 1, 255, 0, 255, 255,
+	0, 4, 255, 0, 1, 255, 4, 4, 255, 0, 4, 255, 1, 1, 1, 255, 255, 255, 0, 8, 2, 1, 1, 1,
+	255, 255, 255, 0, 8, 3, 1, 1, 1, 255, 255, 255, 0, 8, 255, 1, 1, 1, 255, 255, 255, 0, 8, 2,
+	1, 1, 1, 255, 255, 255, 0, 8, 8, 1, 1, 1, 255, 255, 255, 0, 8, 255, 1, 1, 255, 255, 255, 255,
+	0, 8, 255, 1, 1, 255, 255, 255, 255, 0, 8, 255, 1, 1, 255, 255, 255, 255, 0, 8, 255, 0, 1, 1,
+	0, 2, 2, 0, 2, 2, 3, 1, 1, 0, 255, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	2, 2, 1, 2, 2, 2, 2, 2, 2, 0, 1, 8, 0, 255, 8, 0, 8, 8, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 1, 2, 1, 0, 2, 6, 4, 4, 2, 0, 1, 8, 0, 255, 6, 4, 4, 4,
+	0, 6, 1, 6, 6, 3, 0, 4, 255, 4, 6, 4, 0, 2, 4, 4, 6, 2, 0, 1, 4, 0, 255, 4,
+	4, 6, 4, 4, 6, 1, 4, 6, 4, 0, 6, 255, 0, 2, 6, 6, 2, 6, 4, 4, 2, 0, 1, 6,
+	0, 255, 6, 4, 4, 4, 0, 1, 1, 0, 4, 6, 0, 4, 255, 0, 8, 3, 0, 2, 3, 0, 8, 2,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 3, 8, 1, 3, 8, 3, 0, 8, 255, 5, 5, 5, 5, 2, 5,
+	5, 5, 5, 5, 1, 5, 0, 255, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 255, 0, 8, 6,
+	0, 2, 6, 0, 8, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 6, 8, 1, 6, 8, 6, 0, 8, 255,
+	1, 1, 1, 0, 2, 8, 255, 255, 255, 1, 1, 1, 0, 255, 8, 255, 255, 255, 0, 1, 1, 6, 6, 3,
+	255, 255, 255, 1, 6, 1, 0, 2, 8, 255, 255, 255, 1, 1, 1, 0, 255, 8, 255, 255, 255, 0, 6, 1,
+	6, 6, 5, 255, 255, 255, 0, 1, 1, 5, 2, 2, 255, 255, 255, 0, 1, 1, 0, 255, 5, 255, 255, 255,
+	0, 1, 1, 0, 5, 5, 255, 255, 255, 4, 2, 4, 2, 2, 3, 4, 4, 2, 8, 1, 8, 0, 255, 8,
+	8, 8, 8, 4, 3, 1, 3, 3, 4, 0, 4, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4,
+	0, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 255, 0, 2, 6, 2, 2, 6, 4, 4, 2,
+	8, 1, 8, 0, 255, 8, 8, 8, 8, 0, 4, 1, 6, 4, 6, 0, 4, 255, 3, 3, 3, 3, 2, 3,
+	3, 3, 3, 3, 1, 3, 0, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	2, 8, 6, 0, 2, 6, 2, 8, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 0, 8, 1, 0, 8, 6,
+	0, 8, 255, 1, 1, 1, 2, 2, 8, 255, 255, 255, 8, 1, 8, 0, 255, 8, 255, 255, 255, 0, 1, 1,
+	6, 6, 3, 255, 255, 255, 1, 6, 1, 0, 2, 8, 255, 255, 255, 8, 1, 8, 0, 255, 8, 255, 255, 255,
+	0, 6, 1, 6, 6, 6, 255, 255, 255, 1, 1, 1, 2, 2, 2, 255, 255, 255, 8, 1, 8, 0, 255, 8,
+	255, 255, 255, 0, 1, 1, 6, 6, 6, 255, 255, 255, 0, 2, 1, 6, 2, 2, 4, 4, 2, 0, 1, 1,
+	0, 255, 3, 4, 4, 4, 8, 8, 1, 8, 8, 8, 0, 3, 255, 2, 6, 1, 0, 2, 8, 4, 6, 2,
+	0, 1, 4, 0, 255, 4, 4, 6, 4, 8, 6, 1, 8, 6, 8, 0, 6, 255, 4, 4, 1, 4, 2, 2,
+	4, 4, 2, 4, 1, 1, 0, 255, 4, 4, 4, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255, 2, 8, 8,
+	0, 2, 6, 2, 8, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 8, 8, 1, 8, 8, 8, 0, 8, 255,
+	0, 6, 2, 0, 2, 2, 0, 6, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 8, 6, 1, 8, 6, 8,
+	0, 6, 255, 6, 8, 6, 0, 2, 6, 0, 8, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 8, 8, 1,
+	8, 8, 6, 0, 8, 255, 0, 1, 1, 3, 2, 2, 255, 255, 255, 0, 1, 1, 0, 255, 3, 255, 255, 255,
+	0, 1, 1, 0, 3, 3, 255, 255, 255, 1, 6, 1, 0, 2, 8, 255, 255, 255, 1, 1, 1, 0, 255, 8,
+	255, 255, 255, 0, 6, 1, 0, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 1, 0, 2, 2, 4, 3, 2,
+	4, 1, 4, 0, 255, 4, 4, 3, 4, 0, 3, 1, 0, 3, 4, 0, 3, 255, 0, 255, 4, 0, 255, 4,
+	0, 255, 2, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 1, 0, 255, 4, 0, 255, 255, 1, 2, 4,
+	2, 2, 4, 4, 4, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 1, 4, 4, 4, 0, 4, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 1, 0, 3, 3,
+	0, 3, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 5,
+	0, 255, 5, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 8, 1, 0, 8, 5, 0, 8, 255, 1, 3, 1, 0, 2, 8, 255, 255, 255, 1, 1, 1, 0, 255, 8,
+	255, 255, 255, 1, 3, 1, 0, 3, 8, 255, 255, 255, 0, 255, 1, 0, 255, 8, 255, 255, 255, 0, 255, 1,
+	0, 255, 8, 255, 255, 255, 0, 255, 1, 0, 255, 8, 255, 255, 255, 0, 1, 1, 5, 2, 2, 255, 255, 255,
+	0, 1, 1, 0, 255, 5, 255, 255, 255, 0, 1, 1, 5, 5, 5, 255, 255, 255, 2, 3, 2, 0, 2, 2,
+	4, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4, 3, 3, 1, 3, 3, 3, 0, 3, 255, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 255,
+	2, 2, 2, 2, 2, 2, 4, 4, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 0, 1, 1, 0, 4, 4,
+	0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 3, 3,
+	3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 8, 1, 0, 8, 8, 0, 8, 255, 1, 3, 1, 0, 2, 8, 255, 255, 255, 8, 1, 8,
+	0, 255, 8, 255, 255, 255, 1, 3, 1, 0, 3, 8, 255, 255, 255, 0, 255, 1, 0, 255, 8, 255, 255, 255,
+	0, 255, 8, 0, 255, 8, 255, 255, 255, 0, 255, 1, 0, 255, 8, 255, 255, 255, 1, 1, 1, 2, 2, 8,
+	255, 255, 255, 8, 1, 8, 0, 255, 8, 255, 255, 255, 1, 1, 1, 0, 8, 8, 255, 255, 255, 0, 3, 1,
+	0, 2, 4, 4, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4, 8, 3, 1, 8, 3, 8, 0, 3, 255,
+	0, 255, 1, 0, 255, 2, 0, 255, 2, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 1, 0, 255, 8,
+	0, 255, 255, 4, 4, 4, 4, 2, 4, 4, 4, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 0, 1, 1,
+	0, 4, 4, 0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	8, 3, 1, 8, 3, 8, 0, 3, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 1, 0, 255, 8, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 8, 8, 1, 8, 8, 8, 0, 8, 255, 0, 3, 1, 3, 2, 2, 255, 255, 255,
+	0, 1, 1, 0, 255, 3, 255, 255, 255, 0, 3, 1, 0, 3, 3, 255, 255, 255, 0, 255, 1, 0, 255, 8,
+	255, 255, 255, 0, 255, 1, 0, 255, 8, 255, 255, 255, 0, 255, 1, 0, 255, 8, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	8, 8, 1, 8, 2, 2, 0, 2, 2, 8, 1, 1, 0, 255, 3, 0, 3, 3, 0, 1, 1, 0, 3, 3,
+	0, 3, 255, 8, 8, 8, 8, 2, 8, 0, 2, 2, 8, 1, 8, 0, 255, 8, 0, 4, 4, 0, 1, 1,
+	0, 4, 4, 0, 4, 255, 0, 8, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255,
+	0, 1, 255, 0, 4, 255, 0, 4, 255, 8, 8, 1, 8, 2, 2, 8, 8, 2, 8, 1, 1, 0, 255, 3,
+	8, 8, 3, 8, 8, 1, 8, 8, 3, 0, 8, 255, 5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 1, 5,
+	0, 255, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 255, 0, 8, 255, 0, 2, 255, 0, 8, 255,
+	0, 1, 255, 0, 255, 255, 0, 8, 255, 0, 8, 255, 0, 8, 255, 0, 8, 255, 0, 1, 1, 0, 2, 2,
+	255, 255, 255, 0, 1, 1, 0, 255, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1,
+	0, 2, 2, 255, 255, 255, 0, 1, 1, 0, 255, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 1, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 8, 8, 1, 8, 2, 2, 0, 2, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 0, 1, 1,
+	0, 3, 3, 0, 3, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 255, 0, 8, 255, 0, 2, 255, 0, 2, 255, 8, 1, 255, 0, 255, 255,
+	8, 8, 255, 0, 1, 255, 0, 4, 255, 0, 4, 255, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 1, 3,
+	0, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 8, 255, 0, 2, 255,
+	0, 8, 255, 8, 1, 255, 0, 255, 255, 8, 8, 255, 0, 8, 255, 0, 8, 255, 0, 8, 255, 0, 1, 1,
+	0, 2, 2, 255, 255, 255, 8, 1, 8, 0, 255, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 1, 1, 0, 2, 2, 255, 255, 255, 8, 1, 8, 0, 255, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 1, 255, 0, 2, 255, 255, 255, 255, 8, 1, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 8, 8, 1, 8, 2, 2, 0, 2, 2, 8, 1, 1, 0, 255, 3, 0, 3, 3,
+	0, 1, 1, 0, 3, 3, 0, 3, 255, 8, 8, 8, 8, 2, 8, 0, 2, 2, 8, 1, 8, 0, 255, 8,
+	0, 4, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255,
+	0, 255, 255, 0, 4, 255, 0, 1, 255, 0, 4, 255, 0, 4, 255, 8, 8, 1, 8, 2, 2, 8, 8, 2,
+	8, 1, 1, 0, 255, 3, 8, 8, 3, 8, 8, 1, 8, 8, 3, 0, 8, 255, 8, 8, 8, 8, 2, 8,
+	8, 8, 2, 8, 1, 8, 0, 255, 8, 8, 8, 8, 8, 8, 1, 8, 8, 8, 0, 8, 255, 0, 8, 255,
+	0, 2, 255, 0, 8, 255, 0, 1, 255, 0, 255, 255, 0, 8, 255, 0, 8, 255, 0, 8, 255, 0, 8, 255,
+	0, 1, 1, 0, 2, 2, 255, 255, 255, 0, 1, 1, 0, 255, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 1, 1, 0, 2, 2, 255, 255, 255, 0, 1, 1, 0, 255, 8, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 4, 2, 0, 2, 7, 2, 4, 2, 5, 1, 5, 0, 255, 5,
+	5, 4, 5, 0, 4, 1, 4, 4, 7, 0, 4, 255, 0, 4, 5, 0, 2, 4, 0, 4, 2, 5, 1, 5,
+	0, 255, 5, 5, 4, 5, 0, 4, 1, 0, 4, 4, 0, 4, 255, 2, 4, 6, 0, 2, 6, 2, 4, 2,
+	5, 1, 5, 0, 255, 5, 5, 4, 5, 6, 4, 1, 4, 4, 6, 0, 4, 255, 0, 255, 2, 0, 255, 7,
+	0, 255, 2, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 1, 0, 255, 7, 0, 255, 255, 0, 255, 5,
+	0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 255,
+	0, 255, 6, 0, 255, 7, 0, 255, 2, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 1, 0, 255, 7,
+	0, 255, 255, 0, 2, 2, 2, 2, 2, 7, 7, 2, 5, 1, 5, 0, 255, 5, 5, 5, 5, 6, 6, 1,
+	6, 6, 6, 0, 3, 255, 6, 6, 1, 0, 2, 2, 7, 6, 2, 5, 1, 5, 0, 255, 5, 5, 5, 5,
+	6, 6, 1, 6, 6, 6, 0, 6, 255, 5, 5, 1, 5, 2, 2, 0, 2, 2, 5, 1, 5, 0, 255, 5,
+	5, 5, 5, 0, 1, 1, 0, 5, 5, 0, 5, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 4, 4, 1, 4, 4, 4, 0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 4, 4, 4, 4, 4, 4, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 4, 1, 4, 4, 6, 0, 4, 255, 0, 255, 2,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 3, 0, 255, 3, 0, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1,
+	0, 255, 7, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	6, 6, 1, 6, 6, 6, 0, 3, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 6, 6, 1, 6, 6, 6, 0, 6, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 6, 6, 1, 6, 6, 6, 0, 6, 255, 4, 4, 3, 0, 2, 7, 6, 4, 2,
+	0, 1, 6, 0, 255, 4, 4, 4, 6, 6, 4, 1, 4, 4, 7, 0, 4, 255, 0, 4, 1, 0, 2, 7,
+	0, 4, 2, 0, 1, 6, 0, 255, 4, 0, 4, 6, 0, 4, 1, 0, 4, 7, 0, 4, 255, 4, 4, 1,
+	4, 2, 2, 4, 4, 2, 4, 1, 1, 0, 255, 4, 4, 4, 4, 4, 4, 1, 4, 4, 4, 0, 4, 255,
+	0, 255, 6, 0, 255, 7, 0, 255, 2, 0, 255, 6, 0, 255, 6, 0, 255, 6, 0, 255, 1, 0, 255, 7,
+	0, 255, 255, 0, 255, 6, 0, 255, 7, 0, 255, 2, 0, 255, 6, 0, 255, 6, 0, 255, 6, 0, 255, 1,
+	0, 255, 7, 0, 255, 255, 0, 255, 6, 0, 255, 7, 0, 255, 2, 0, 255, 6, 0, 255, 6, 0, 255, 6,
+	0, 255, 1, 0, 255, 7, 0, 255, 255, 3, 3, 3, 3, 2, 3, 0, 2, 2, 3, 1, 3, 0, 255, 3,
+	0, 3, 3, 0, 1, 1, 0, 3, 3, 0, 3, 255, 6, 6, 1, 0, 2, 2, 7, 6, 2, 0, 1, 1,
+	0, 255, 6, 7, 6, 7, 6, 6, 1, 6, 6, 6, 0, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 3, 7, 7, 2, 7,
+	7, 3, 7, 4, 1, 4, 0, 255, 4, 4, 3, 4, 7, 3, 7, 7, 3, 7, 7, 3, 255, 0, 255, 7,
+	0, 255, 7, 0, 255, 7, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 7, 0, 255, 7, 0, 255, 255,
+	7, 4, 7, 7, 2, 7, 7, 4, 7, 4, 1, 4, 0, 255, 4, 4, 4, 4, 7, 4, 7, 7, 4, 7,
+	7, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 7,
+	0, 255, 7, 0, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 5, 0, 255, 5, 0, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 7, 0, 255, 7, 0, 255, 255, 7, 3, 7, 7, 2, 7, 7, 3, 7, 5, 1, 5,
+	0, 255, 5, 5, 3, 5, 7, 3, 7, 7, 3, 7, 7, 3, 255, 0, 255, 7, 0, 255, 7, 0, 255, 7,
+	0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 7, 0, 255, 7, 0, 255, 255, 7, 7, 7, 7, 2, 7,
+	7, 7, 7, 5, 1, 5, 0, 255, 5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 3, 7, 7, 3, 7, 7, 3, 255,
+	0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 4, 0, 255, 4,
+	0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 4, 7,
+	7, 4, 7, 7, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 3, 0, 255, 3, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 255, 7, 0, 255, 7, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 3, 7, 7, 3, 7, 7, 3, 255, 0, 255, 2, 0, 255, 2,
+	0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 7, 0, 255, 7, 0, 255, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 7, 7, 7, 7, 7, 7, 7, 255,
+	7, 3, 7, 7, 2, 7, 7, 3, 7, 4, 1, 4, 0, 255, 4, 4, 3, 4, 7, 3, 7, 7, 3, 7,
+	7, 3, 255, 0, 255, 7, 0, 255, 7, 0, 255, 7, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 7,
+	0, 255, 7, 0, 255, 255, 7, 4, 7, 7, 2, 7, 7, 4, 7, 4, 1, 4, 0, 255, 4, 4, 4, 4,
+	7, 4, 7, 7, 4, 7, 7, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 7, 0, 255, 7, 0, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 255, 7, 0, 255, 7, 0, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 7, 0, 255, 7, 0, 255, 255, 7, 3, 7, 7, 2, 7,
+	7, 3, 7, 7, 1, 7, 0, 255, 7, 7, 3, 7, 7, 3, 7, 7, 3, 7, 7, 3, 255, 0, 255, 7,
+	0, 255, 7, 0, 255, 7, 0, 255, 7, 0, 255, 7, 0, 255, 7, 0, 255, 7, 0, 255, 7, 0, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 4, 3, 0, 2, 3, 2, 4, 2, 5, 1, 5, 0, 255, 5, 5, 4, 5, 4, 4, 1,
+	4, 4, 3, 0, 4, 255, 4, 4, 5, 0, 2, 4, 4, 4, 2, 5, 1, 5, 0, 255, 5, 5, 4, 5,
+	4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255, 0, 2, 255, 0, 4, 255, 5, 1, 255, 0, 255, 255,
+	5, 4, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 255, 3, 0, 255, 7, 0, 255, 2, 0, 255, 5,
+	0, 255, 5, 0, 255, 5, 0, 255, 1, 0, 255, 7, 0, 255, 255, 0, 255, 5, 0, 255, 5, 0, 255, 5,
+	0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 2, 2, 1,
+	2, 2, 2, 0, 2, 2, 5, 1, 5, 0, 255, 5, 5, 5, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	2, 2, 2, 2, 2, 2, 0, 2, 2, 5, 1, 5, 0, 255, 5, 5, 5, 5, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 5, 1, 255, 0, 255, 255, 5, 5, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	4, 4, 1, 4, 4, 3, 0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 4, 4, 4, 4, 4, 4, 4, 4, 255, 2, 2, 255, 2, 2, 255, 2, 2, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 3, 0, 255, 3, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 2, 2, 255, 2, 2, 255, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 4, 3, 0, 2, 3, 0, 4, 2, 0, 1, 3, 0, 255, 3,
+	3, 4, 3, 4, 4, 1, 4, 4, 3, 0, 4, 255, 0, 4, 1, 0, 2, 2, 2, 4, 2, 0, 1, 1,
+	0, 255, 4, 0, 4, 4, 4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255, 0, 2, 255, 0, 4, 255,
+	0, 1, 255, 0, 255, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 255, 3, 0, 255, 7,
+	0, 255, 2, 0, 255, 3, 0, 255, 7, 0, 255, 3, 0, 255, 1, 0, 255, 7, 0, 255, 255, 0, 255, 1,
+	0, 255, 7, 0, 255, 2, 0, 255, 1, 0, 255, 7, 0, 255, 7, 0, 255, 1, 0, 255, 7, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2, 3, 1, 3, 0, 255, 3, 0, 3, 3, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 1, 1, 0, 255, 7, 7, 7, 7,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 4, 6, 4, 2, 4, 6, 4, 6, 5, 1, 5,
+	0, 255, 4, 5, 4, 5, 6, 4, 6, 4, 4, 4, 6, 4, 255, 6, 4, 6, 4, 2, 4, 6, 4, 6,
+	5, 1, 5, 0, 255, 4, 5, 4, 5, 6, 4, 6, 4, 4, 4, 6, 4, 255, 6, 4, 6, 4, 2, 4,
+	6, 4, 6, 5, 1, 5, 0, 255, 4, 5, 4, 5, 6, 4, 6, 4, 4, 4, 6, 4, 255, 0, 255, 1,
+	255, 255, 255, 0, 255, 6, 0, 255, 1, 255, 255, 255, 0, 255, 5, 0, 255, 1, 255, 255, 255, 0, 255, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 5, 0, 255, 1, 255, 255, 255, 0, 255, 5, 0, 255, 1, 255, 255, 255,
+	0, 255, 255, 0, 255, 1, 255, 255, 255, 0, 255, 6, 0, 255, 1, 255, 255, 255, 0, 255, 5, 0, 255, 1,
+	255, 255, 255, 0, 255, 255, 6, 6, 6, 6, 2, 6, 6, 6, 6, 5, 1, 5, 0, 255, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 2, 6, 6, 6, 6, 5, 1, 5, 0, 255, 5,
+	5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 2, 6, 6, 6, 6, 5, 1, 5,
+	0, 255, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 4, 6, 4, 4, 4, 6, 4, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 4, 4, 4, 4, 4, 4, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 4, 6, 4, 4, 4, 6, 4, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 4, 6, 4, 2, 4,
+	6, 4, 6, 6, 1, 6, 0, 255, 4, 6, 4, 6, 6, 4, 6, 4, 4, 4, 6, 4, 255, 6, 4, 6,
+	4, 2, 4, 6, 4, 6, 6, 1, 6, 0, 255, 4, 6, 4, 6, 6, 4, 6, 4, 4, 4, 6, 4, 255,
+	6, 4, 6, 4, 2, 4, 6, 4, 6, 6, 1, 6, 0, 255, 4, 6, 4, 6, 6, 4, 6, 4, 4, 4,
+	6, 4, 255, 0, 255, 1, 255, 255, 255, 0, 255, 6, 0, 255, 1, 255, 255, 255, 0, 255, 6, 0, 255, 1,
+	255, 255, 255, 0, 255, 255, 0, 255, 1, 255, 255, 255, 0, 255, 6, 0, 255, 1, 255, 255, 255, 0, 255, 6,
+	0, 255, 1, 255, 255, 255, 0, 255, 255, 0, 255, 1, 255, 255, 255, 0, 255, 6, 0, 255, 1, 255, 255, 255,
+	0, 255, 6, 0, 255, 1, 255, 255, 255, 0, 255, 255, 6, 6, 6, 6, 2, 6, 6, 6, 6, 6, 1, 6,
+	0, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 2, 6, 6, 6, 6,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 4, 4, 3, 4, 2, 4, 0, 4, 2, 5, 1, 5, 0, 255, 4, 5, 4, 5,
+	4, 4, 1, 4, 4, 4, 0, 4, 255, 4, 4, 4, 4, 2, 4, 4, 4, 2, 5, 1, 5, 0, 255, 4,
+	5, 4, 5, 4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255, 4, 2, 255, 0, 4, 255, 5, 1, 255,
+	0, 255, 255, 5, 4, 255, 0, 4, 255, 4, 4, 255, 0, 4, 255, 0, 255, 1, 255, 255, 255, 0, 255, 2,
+	0, 255, 1, 255, 255, 255, 0, 255, 5, 0, 255, 1, 255, 255, 255, 0, 255, 255, 0, 255, 1, 255, 255, 255,
+	0, 255, 5, 0, 255, 1, 255, 255, 255, 0, 255, 5, 0, 255, 1, 255, 255, 255, 0, 255, 255, 0, 255, 255,
+	255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255,
+	2, 2, 1, 2, 2, 2, 2, 2, 2, 5, 1, 5, 0, 255, 5, 5, 5, 5, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 1, 5, 0, 255, 5, 5, 5, 5, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 5, 1, 255, 0, 255, 255, 5, 5, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 4, 4, 1, 4, 4, 4, 0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 4, 4, 4, 4, 4, 4, 4, 4, 255, 2, 2, 255, 2, 2, 255, 2, 2, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 4, 255, 4, 4, 255, 0, 4, 255, 0, 255, 1, 255, 255, 255,
+	0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+	0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 255, 2, 2, 255, 2, 2, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 3, 4, 2, 4, 0, 4, 2, 0, 1, 3,
+	0, 255, 4, 0, 4, 3, 4, 4, 1, 4, 4, 4, 0, 4, 255, 4, 4, 1, 4, 2, 4, 0, 4, 2,
+	0, 1, 1, 0, 255, 4, 0, 4, 4, 4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255, 4, 2, 255,
+	0, 4, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255, 0, 4, 255, 4, 4, 255, 0, 4, 255, 0, 255, 1,
+	255, 255, 255, 0, 255, 2, 0, 255, 1, 255, 255, 255, 0, 255, 3, 0, 255, 1, 255, 255, 255, 0, 255, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 2, 0, 255, 1, 255, 255, 255, 0, 255, 255, 0, 255, 1, 255, 255, 255,
+	0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255,
+	255, 255, 255, 0, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2, 3, 1, 3, 0, 255, 3, 3, 3, 3,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 1, 0, 255, 255,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 4, 1, 0, 2, 2, 4, 4, 2,
+	5, 1, 5, 0, 255, 5, 5, 4, 5, 1, 4, 1, 0, 4, 3, 0, 4, 255, 0, 4, 5, 0, 2, 5,
+	4, 4, 2, 5, 1, 5, 0, 255, 5, 5, 4, 5, 0, 4, 1, 0, 4, 4, 0, 4, 255, 2, 4, 6,
+	0, 2, 6, 4, 4, 2, 5, 1, 5, 0, 255, 5, 5, 4, 5, 0, 4, 1, 4, 4, 6, 0, 4, 255,
+	0, 255, 2, 0, 255, 2, 0, 255, 2, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 1, 0, 255, 3,
+	0, 255, 255, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5,
+	0, 255, 5, 0, 255, 255, 0, 255, 6, 0, 255, 6, 0, 255, 2, 0, 255, 5, 0, 255, 5, 0, 255, 5,
+	0, 255, 1, 0, 255, 6, 0, 255, 255, 1, 1, 1, 2, 2, 2, 255, 255, 255, 5, 1, 5, 0, 255, 5,
+	255, 255, 255, 0, 1, 1, 6, 6, 6, 255, 255, 255, 1, 6, 1, 0, 2, 2, 255, 255, 255, 5, 1, 5,
+	0, 255, 5, 255, 255, 255, 0, 6, 1, 6, 6, 6, 255, 255, 255, 0, 1, 1, 5, 2, 2, 255, 255, 255,
+	5, 1, 5, 0, 255, 5, 255, 255, 255, 0, 1, 1, 0, 5, 5, 255, 255, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 1, 4, 4, 3, 0, 4, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 4, 4, 4, 4, 4, 4, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 4, 1, 0, 4, 6,
+	0, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 3,
+	0, 255, 3, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 1, 0, 255, 6, 0, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 1, 1, 6, 6, 6, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 6, 1, 6, 6, 6, 255, 255, 255, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 6, 6, 6, 255, 255, 255, 1, 4, 4,
+	0, 2, 3, 4, 4, 2, 0, 1, 3, 0, 255, 3, 4, 4, 4, 4, 4, 1, 3, 4, 3, 0, 4, 255,
+	0, 4, 1, 0, 2, 2, 4, 4, 2, 0, 1, 1, 0, 255, 4, 4, 4, 4, 0, 4, 1, 0, 4, 4,
+	0, 4, 255, 4, 4, 1, 4, 2, 2, 4, 4, 2, 4, 1, 1, 0, 255, 4, 4, 4, 4, 4, 4, 1,
+	4, 4, 4, 0, 4, 255, 0, 255, 1, 0, 255, 2, 0, 255, 2, 0, 255, 6, 0, 255, 6, 0, 255, 6,
+	0, 255, 1, 0, 255, 3, 0, 255, 255, 0, 255, 1, 0, 255, 2, 0, 255, 2, 0, 255, 6, 0, 255, 6,
+	0, 255, 6, 0, 255, 1, 0, 255, 6, 0, 255, 255, 0, 255, 6, 0, 255, 6, 0, 255, 2, 0, 255, 6,
+	0, 255, 6, 0, 255, 6, 0, 255, 1, 0, 255, 6, 0, 255, 255, 0, 1, 1, 3, 2, 3, 255, 255, 255,
+	0, 1, 1, 0, 255, 3, 255, 255, 255, 0, 1, 1, 0, 3, 3, 255, 255, 255, 1, 6, 1, 0, 2, 2,
+	255, 255, 255, 1, 1, 1, 0, 255, 6, 255, 255, 255, 0, 6, 1, 6, 6, 6, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 3, 2, 0, 2, 2, 4, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4, 0, 3, 1, 0, 3, 3,
+	0, 3, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 1,
+	0, 255, 4, 0, 255, 255, 2, 4, 2, 0, 2, 2, 4, 4, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4,
+	1, 4, 1, 0, 4, 4, 0, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 1, 0, 255, 3, 0, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 255, 5, 0, 255, 5, 0, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 5, 0, 255, 255, 1, 3, 1, 0, 2, 2,
+	255, 255, 255, 5, 1, 5, 0, 255, 5, 255, 255, 255, 1, 3, 1, 0, 3, 3, 255, 255, 255, 0, 255, 1,
+	0, 255, 2, 255, 255, 255, 0, 255, 5, 0, 255, 5, 255, 255, 255, 0, 255, 1, 0, 255, 5, 255, 255, 255,
+	0, 1, 1, 5, 2, 5, 255, 255, 255, 5, 1, 5, 0, 255, 5, 255, 255, 255, 0, 1, 1, 5, 5, 5,
+	255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 1,
+	0, 3, 3, 0, 3, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 4, 0, 255, 4, 0, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 4, 1, 0, 4, 4, 0, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 255, 3, 0, 255, 3, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 2, 0, 255, 2,
+	0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 255, 0, 255, 255, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 3, 1, 0, 3, 3, 255, 255, 255,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 255,
+	255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1,
+	0, 255, 255, 255, 255, 255, 0, 3, 1, 0, 2, 2, 4, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4,
+	0, 3, 1, 0, 3, 3, 0, 3, 255, 0, 255, 1, 0, 255, 2, 0, 255, 2, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 1, 0, 255, 4, 0, 255, 255, 4, 4, 4, 4, 2, 4, 4, 4, 2, 4, 1, 4,
+	0, 255, 4, 4, 4, 4, 4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 3, 0, 255, 255, 0, 255, 2, 0, 255, 2,
+	0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 255, 0, 255, 255, 0, 255, 2,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 255, 0, 255, 255,
+	0, 3, 1, 3, 2, 3, 255, 255, 255, 0, 1, 1, 0, 255, 3, 255, 255, 255, 0, 3, 1, 3, 3, 3,
+	255, 255, 255, 0, 255, 1, 0, 255, 2, 255, 255, 255, 0, 255, 1, 0, 255, 255, 255, 255, 255, 0, 255, 1,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 4, 3, 0, 2, 3, 4, 4, 2, 5, 1, 5, 0, 255, 5,
+	5, 4, 5, 4, 4, 1, 4, 4, 3, 0, 4, 255, 4, 4, 5, 0, 2, 5, 4, 4, 2, 5, 1, 5,
+	0, 255, 5, 5, 4, 5, 4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255, 0, 2, 255, 0, 4, 255,
+	5, 1, 255, 0, 255, 255, 5, 4, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 255, 3, 0, 255, 3,
+	0, 255, 2, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 1, 0, 255, 3, 0, 255, 255, 0, 255, 5,
+	0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 5, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 1, 1, 2, 2, 2, 255, 255, 255, 5, 1, 5, 0, 255, 5, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 1, 1, 2, 2, 2, 255, 255, 255, 5, 1, 5, 0, 255, 5, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 255, 255, 255, 5, 1, 255, 0, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 4, 4, 1, 4, 4, 3, 0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 4, 4, 4, 4, 4, 4, 255, 2, 2, 255, 2, 2, 255,
+	2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 255, 2,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 3, 0, 255, 3, 0, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 255, 2, 2, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 4, 3, 0, 2, 3, 4, 4, 2,
+	0, 1, 3, 0, 255, 3, 4, 4, 3, 4, 4, 1, 4, 4, 3, 0, 4, 255, 1, 4, 1, 0, 2, 2,
+	4, 4, 2, 0, 1, 1, 0, 255, 4, 4, 4, 4, 4, 4, 1, 4, 4, 4, 0, 4, 255, 0, 4, 255,
+	0, 2, 255, 0, 4, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255, 0, 4, 255,
+	0, 255, 3, 0, 255, 3, 0, 255, 2, 0, 255, 3, 0, 255, 3, 0, 255, 3, 0, 255, 1, 0, 255, 3,
+	0, 255, 255, 0, 255, 1, 0, 255, 2, 0, 255, 2, 0, 255, 1, 0, 255, 255, 0, 255, 255, 0, 255, 1,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 1, 1, 0, 2, 2, 255, 255, 255, 0, 1, 1, 0, 255, 3,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 2, 2, 2, 255, 255, 255, 1, 1, 1,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 2, 4, 2, 2, 4,
+	0, 4, 2, 0, 1, 4, 0, 255, 4, 4, 6, 4, 5, 5, 1, 5, 5, 3, 0, 5, 255, 6, 6, 4,
+	0, 2, 4, 4, 6, 2, 0, 1, 4, 0, 255, 4, 4, 6, 4, 5, 6, 1, 5, 6, 4, 0, 6, 255,
+	0, 2, 1, 4, 2, 2, 0, 4, 2, 0, 1, 1, 0, 255, 4, 0, 4, 4, 5, 5, 1, 5, 5, 4,
+	0, 5, 255, 0, 1, 1, 7, 2, 7, 0, 3, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 5, 5, 1,
+	7, 7, 7, 0, 5, 255, 5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 1, 5, 0, 255, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 255, 0, 1, 6, 7, 2, 7, 0, 2, 2, 6, 1, 6, 0, 255, 6,
+	6, 6, 6, 5, 5, 1, 7, 7, 7, 0, 5, 255, 0, 2, 255, 0, 2, 255, 0, 7, 255, 0, 1, 255,
+	0, 255, 255, 0, 7, 255, 0, 1, 255, 0, 3, 255, 0, 3, 255, 0, 6, 255, 0, 2, 255, 0, 6, 255,
+	0, 1, 255, 0, 255, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 5, 255, 0, 2, 255,
+	0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 5, 255, 0, 1, 255, 0, 5, 255, 0, 5, 255, 0, 3, 4,
+	4, 2, 4, 4, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4, 4, 3, 1, 4, 3, 4, 0, 3, 255,
+	4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 255, 0, 1, 1, 0, 2, 2, 0, 4, 2, 0, 1, 1, 0, 255, 4, 0, 4, 4, 0, 4, 1,
+	4, 4, 4, 0, 4, 255, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 1, 3, 0, 255, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 6, 7, 2, 7, 0, 2, 2, 6, 1, 6,
+	0, 255, 6, 6, 6, 6, 0, 1, 1, 7, 7, 7, 0, 6, 255, 0, 1, 255, 0, 2, 255, 0, 7, 255,
+	0, 1, 255, 0, 255, 255, 0, 7, 255, 0, 6, 255, 0, 6, 255, 0, 3, 255, 0, 6, 255, 0, 2, 255,
+	0, 6, 255, 0, 1, 255, 0, 255, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 1, 255,
+	0, 2, 255, 0, 7, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255,
+	2, 2, 1, 2, 2, 2, 2, 2, 2, 0, 1, 4, 0, 255, 4, 4, 6, 4, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 2, 6, 1, 2, 2, 2, 2, 6, 2, 0, 1, 4, 0, 255, 4, 6, 6, 4, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2, 4, 1, 1, 0, 255, 4, 4, 4, 4,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 7, 2, 7, 2, 2, 2, 6, 1, 6, 0, 255, 6,
+	6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 6, 2, 7, 2, 7, 2, 6, 2, 6, 1, 6,
+	0, 255, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1, 7, 2, 7, 2, 2, 2,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255,
+	0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 6, 255,
+	0, 2, 255, 0, 6, 255, 0, 1, 255, 0, 255, 255, 0, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 3, 4, 0, 2, 4, 0, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4, 5, 3, 1,
+	5, 3, 3, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 2, 0, 255, 4, 0, 255, 4, 0, 255, 4,
+	0, 255, 1, 0, 255, 4, 0, 255, 255, 4, 2, 4, 2, 2, 4, 0, 4, 2, 4, 1, 4, 0, 255, 4,
+	4, 4, 4, 5, 5, 1, 5, 5, 4, 0, 5, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 5, 3, 1, 7, 3, 7, 0, 3, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 5, 0, 255, 5, 0, 255, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 5, 5, 1, 7, 7, 7, 0, 5, 255, 0, 3, 255,
+	0, 2, 255, 0, 3, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 0, 3, 255, 0, 3, 255, 0, 3, 255,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 5, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 5, 255, 0, 5, 255,
+	0, 5, 255, 0, 5, 255, 3, 3, 4, 0, 2, 4, 3, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4,
+	3, 3, 1, 3, 3, 4, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 255, 0, 2, 4, 2, 2, 4, 0, 2, 2, 4, 1, 4,
+	0, 255, 4, 4, 4, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 7, 7, 7, 0, 7, 255,
+	0, 3, 255, 0, 2, 255, 0, 3, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 0, 3, 255, 0, 3, 255,
+	0, 3, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 1, 255, 0, 2, 255, 0, 7, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255,
+	0, 1, 255, 0, 7, 255, 0, 7, 255, 2, 3, 1, 2, 2, 2, 2, 3, 2, 4, 1, 4, 0, 255, 4,
+	4, 3, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 2, 0, 255, 2, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2,
+	4, 1, 4, 0, 255, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 2,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 3, 255, 0, 2, 255, 0, 3, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 7, 1, 7, 2, 2, 7, 7, 2, 7, 1, 1,
+	0, 255, 3, 7, 7, 3, 0, 1, 1, 0, 3, 3, 0, 3, 255, 7, 7, 1, 7, 2, 2, 7, 7, 2,
+	7, 1, 1, 0, 255, 4, 7, 7, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255, 0, 7, 255, 0, 2, 255,
+	0, 7, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255, 0, 1, 255, 0, 4, 255, 0, 4, 255, 7, 7, 1,
+	7, 2, 7, 7, 7, 2, 7, 1, 1, 0, 255, 7, 7, 7, 3, 0, 1, 1, 7, 7, 7, 0, 3, 255,
+	5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 1, 5, 0, 255, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 255, 0, 7, 255, 7, 2, 255, 0, 7, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255, 0, 1, 255,
+	7, 7, 255, 0, 5, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255,
+	0, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255,
+	0, 255, 255, 0, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 7, 1, 7, 2, 2, 7, 7, 2,
+	7, 1, 1, 0, 255, 3, 7, 7, 3, 0, 1, 1, 0, 3, 3, 0, 3, 255, 4, 4, 4, 4, 2, 4,
+	4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 255, 0, 7, 255,
+	0, 2, 255, 0, 7, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255, 0, 1, 255, 0, 4, 255, 0, 4, 255,
+	3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 1, 3, 0, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 7, 255, 7, 2, 255, 0, 7, 255, 0, 1, 255, 0, 255, 255, 0, 7, 255,
+	0, 7, 255, 7, 7, 255, 0, 7, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255,
+	0, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255,
+	0, 255, 255, 0, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255,
+	0, 1, 255, 0, 255, 255, 0, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 0, 2, 2,
+	0, 2, 2, 7, 1, 1, 0, 255, 3, 7, 7, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1,
+	0, 2, 2, 0, 2, 2, 7, 1, 1, 0, 255, 4, 7, 7, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 1, 1, 7, 2, 7, 0, 2, 2, 7, 1, 1, 0, 255, 7, 7, 7, 3, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 1, 1, 7, 2, 7, 0, 2, 2, 7, 1, 7, 0, 255, 7, 7, 7, 7,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 7, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255,
+	0, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255,
+	0, 255, 255, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255,
+	0, 1, 255, 0, 255, 255, 0, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 4,
+	4, 2, 4, 0, 2, 2, 1, 1, 4, 0, 255, 4, 0, 6, 4, 5, 5, 1, 4, 4, 4, 0, 5, 255,
+	4, 6, 4, 4, 2, 4, 0, 6, 2, 0, 1, 4, 0, 255, 4, 4, 6, 4, 5, 6, 1, 4, 4, 4,
+	0, 6, 255, 4, 1, 1, 4, 2, 4, 0, 2, 2, 1, 1, 1, 0, 255, 4, 0, 4, 4, 5, 5, 1,
+	4, 4, 4, 0, 5, 255, 1, 1, 1, 255, 255, 255, 0, 3, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6,
+	1, 1, 1, 255, 255, 255, 0, 5, 255, 1, 1, 1, 255, 255, 255, 5, 5, 5, 1, 1, 1, 255, 255, 255,
+	5, 5, 5, 1, 1, 1, 255, 255, 255, 5, 5, 255, 1, 1, 1, 255, 255, 255, 0, 2, 2, 1, 1, 1,
+	255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 5, 255, 0, 2, 255, 0, 2, 255, 0, 2, 255,
+	0, 1, 255, 0, 255, 255, 0, 3, 255, 0, 1, 255, 0, 3, 255, 0, 3, 255, 0, 6, 255, 0, 2, 255,
+	0, 6, 255, 0, 1, 255, 0, 255, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 5, 255,
+	0, 2, 255, 0, 5, 255, 0, 1, 255, 0, 255, 255, 0, 5, 255, 0, 1, 255, 0, 5, 255, 0, 5, 255,
+	4, 1, 4, 4, 2, 4, 0, 3, 2, 1, 1, 4, 0, 255, 4, 4, 3, 4, 4, 3, 1, 4, 4, 4,
+	0, 3, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 255, 0, 1, 1, 4, 2, 4, 0, 2, 2, 1, 1, 1, 0, 255, 4, 0, 4, 4,
+	0, 1, 1, 4, 4, 4, 0, 4, 255, 1, 1, 1, 255, 255, 255, 3, 3, 3, 1, 1, 1, 255, 255, 255,
+	3, 3, 3, 1, 1, 1, 255, 255, 255, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 0, 2, 2,
+	1, 1, 1, 255, 255, 255, 6, 6, 6, 1, 1, 1, 255, 255, 255, 0, 6, 255, 0, 1, 255, 0, 2, 255,
+	0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255,
+	0, 2, 255, 0, 6, 255, 0, 1, 255, 0, 255, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255,
+	0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 6, 255, 0, 6, 255, 0, 6, 255,
+	0, 6, 255, 2, 2, 1, 4, 2, 4, 2, 2, 2, 1, 1, 4, 0, 255, 4, 0, 6, 4, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 2, 6, 1, 4, 2, 4, 2, 6, 2, 0, 1, 4, 0, 255, 4, 6, 6, 4,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 4, 2, 4, 0, 2, 2, 4, 1, 1, 0, 255, 4,
+	4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 1, 1, 1,
+	255, 255, 255, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 2, 6, 2,
+	1, 1, 1, 255, 255, 255, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255,
+	2, 2, 2, 1, 1, 1, 255, 255, 255, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255,
+	0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 6, 255, 0, 2, 255, 0, 6, 255, 0, 1, 255, 0, 255, 255, 0, 6, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 4, 3, 4, 4, 2, 4, 0, 3, 2, 4, 1, 4, 0, 255, 4, 4, 3, 4,
+	5, 3, 1, 4, 3, 4, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 2, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 1, 0, 255, 4, 0, 255, 255, 4, 1, 4, 4, 2, 4, 0, 2, 2, 4, 1, 4,
+	0, 255, 4, 4, 4, 4, 5, 5, 1, 4, 4, 4, 0, 5, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 0, 3, 255, 0, 255, 1, 255, 255, 255,
+	0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 0, 255, 255, 1, 1, 1,
+	255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 0, 5, 255,
+	0, 3, 255, 0, 2, 255, 0, 3, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 0, 3, 255, 0, 3, 255,
+	0, 3, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 5, 255, 0, 2, 255, 0, 5, 255, 0, 1, 255, 0, 255, 255, 0, 5, 255,
+	0, 5, 255, 0, 5, 255, 0, 5, 255, 3, 3, 4, 4, 2, 4, 3, 3, 2, 4, 1, 4, 0, 255, 4,
+	4, 3, 4, 3, 3, 1, 4, 3, 4, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 255, 4, 1, 4, 4, 2, 4, 0, 2, 2,
+	4, 1, 4, 0, 255, 4, 4, 4, 4, 0, 1, 1, 4, 4, 4, 0, 4, 255, 1, 1, 1, 255, 255, 255,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 3, 3, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255,
+	0, 255, 255, 0, 3, 255, 0, 2, 255, 0, 3, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255, 0, 3, 255,
+	0, 3, 255, 0, 3, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255,
+	0, 255, 255, 0, 1, 255, 0, 255, 255, 0, 255, 255, 2, 3, 1, 4, 2, 4, 2, 3, 2, 4, 1, 4,
+	0, 255, 4, 4, 3, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 4, 0, 255, 2,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 4, 2, 4,
+	0, 2, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1,
+	255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 255, 1, 255, 255, 255, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 3, 255, 0, 2, 255, 0, 3, 255, 0, 1, 255, 0, 255, 255, 0, 3, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 1, 1, 4, 2, 4, 0, 2, 2,
+	1, 1, 1, 0, 255, 4, 0, 3, 3, 0, 1, 1, 4, 4, 4, 0, 3, 255, 4, 1, 4, 4, 2, 4,
+	2, 2, 2, 1, 1, 4, 0, 255, 4, 0, 4, 4, 0, 1, 1, 4, 4, 4, 0, 4, 255, 0, 1, 255,
+	4, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255, 0, 1, 255, 4, 4, 255, 0, 4, 255,
+	1, 1, 1, 255, 255, 255, 0, 2, 2, 1, 1, 1, 255, 255, 255, 0, 3, 3, 1, 1, 1, 255, 255, 255,
+	0, 5, 255, 1, 1, 1, 255, 255, 255, 5, 5, 5, 1, 1, 1, 255, 255, 255, 5, 5, 5, 1, 1, 1,
+	255, 255, 255, 5, 5, 255, 1, 1, 255, 255, 255, 255, 0, 2, 255, 1, 1, 255, 255, 255, 255, 0, 5, 255,
+	1, 1, 255, 255, 255, 255, 0, 5, 255, 0, 2, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255,
+	0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 2, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255,
+	0, 255, 255, 0, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255,
+	0, 1, 255, 0, 255, 255, 0, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 4, 1, 1, 4, 2, 4,
+	0, 2, 2, 1, 1, 1, 0, 255, 4, 0, 3, 3, 4, 4, 1, 4, 4, 4, 0, 4, 255, 4, 4, 4,
+	4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 255,
+	0, 1, 255, 4, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255, 0, 4, 255, 4, 4, 255,
+	0, 4, 255, 1, 1, 1, 255, 255, 255, 3, 3, 3, 1, 1, 1, 255, 255, 255, 3, 3, 3, 1, 1, 1,
+	255, 255, 255, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 255, 255, 255, 255, 0, 2, 255, 1, 1, 255, 255, 255, 255,
+	0, 255, 255, 1, 1, 255, 255, 255, 255, 0, 255, 255, 0, 2, 255, 0, 2, 255, 0, 2, 255, 0, 1, 255,
+	0, 255, 255, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 2, 255, 0, 2, 255, 0, 2, 255,
+	0, 1, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 2, 255, 0, 2, 255,
+	0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 1,
+	4, 2, 4, 2, 2, 2, 1, 1, 1, 0, 255, 4, 0, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	2, 2, 1, 4, 2, 4, 2, 2, 2, 1, 1, 4, 0, 255, 4, 0, 4, 4, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 1, 255, 4, 2, 255, 0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 4, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 1, 1, 1, 255, 255, 255, 0, 3, 3,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 255, 255, 255, 2, 2, 2, 1, 1, 1, 255, 255, 255,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 255, 255, 255, 255, 0, 2, 255, 1, 1, 255,
+	255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 0, 2, 255,
+	0, 1, 255, 0, 255, 255, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 2, 255, 0, 2, 255,
+	0, 2, 255, 0, 1, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	6, 6, 1, 6, 2, 2, 0, 2, 2, 6, 1, 1, 0, 255, 3, 0, 3, 3, 0, 1, 1, 0, 3, 3,
+	0, 3, 255, 6, 6, 1, 6, 2, 2, 0, 6, 2, 6, 1, 1, 0, 255, 4, 0, 6, 4, 0, 6, 1,
+	0, 6, 4, 0, 6, 255, 6, 6, 1, 6, 2, 2, 0, 2, 2, 6, 1, 1, 0, 255, 4, 0, 4, 4,
+	0, 1, 1, 0, 4, 4, 0, 4, 255, 6, 6, 6, 6, 2, 6, 6, 6, 2, 6, 1, 6, 0, 255, 6,
+	6, 6, 6, 0, 1, 1, 0, 3, 3, 0, 3, 255, 5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 1, 5,
+	0, 255, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 255, 6, 6, 6, 6, 2, 6, 6, 6, 2,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 0, 1, 1, 0, 5, 5, 0, 5, 255, 0, 1, 255, 0, 2, 255,
+	255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 1, 255, 0, 3, 255, 255, 255, 255, 0, 6, 255,
+	0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 6, 255, 0, 6, 255, 255, 255, 255,
+	0, 1, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 1, 255, 0, 5, 255,
+	255, 255, 255, 6, 6, 1, 6, 2, 2, 0, 2, 2, 6, 1, 1, 0, 255, 3, 0, 3, 3, 6, 6, 1,
+	6, 6, 3, 0, 3, 255, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 1, 4, 0, 255, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 255, 6, 6, 1, 6, 2, 2, 0, 2, 2, 6, 1, 1, 0, 255, 4,
+	0, 4, 4, 6, 6, 1, 6, 6, 4, 0, 4, 255, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 1, 3,
+	0, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 6, 6, 6, 2, 6,
+	6, 6, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 6, 6, 1, 6, 6, 6, 0, 6, 255, 0, 1, 255,
+	0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 1, 255, 0, 6, 255, 255, 255, 255,
+	0, 6, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 6, 255, 0, 6, 255,
+	255, 255, 255, 0, 1, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 1, 255,
+	0, 6, 255, 255, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2, 6, 1, 1, 0, 255, 3, 0, 3, 3,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 6, 1, 0, 2, 2, 0, 6, 2, 6, 1, 1, 0, 255, 4,
+	0, 6, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2, 0, 1, 1,
+	0, 255, 4, 0, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1, 0, 2, 2, 0, 2, 2,
+	6, 1, 6, 0, 255, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 6, 1, 0, 2, 2,
+	0, 6, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1,
+	0, 2, 2, 0, 2, 2, 6, 1, 6, 0, 255, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 1, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 6, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 4, 0, 2, 4, 4, 3, 2, 4, 1, 4, 0, 255, 4,
+	4, 3, 4, 5, 3, 1, 5, 3, 3, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 2, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 1, 0, 255, 4, 0, 255, 255, 4, 2, 4, 2, 2, 4, 4, 4, 2,
+	4, 1, 4, 0, 255, 4, 4, 4, 4, 5, 5, 1, 5, 5, 4, 0, 4, 255, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 5, 3, 1, 5, 3, 5, 0, 3, 255, 0, 255, 2,
+	0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 5, 0, 255, 5, 0, 255, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 5, 5, 1, 5, 5, 5,
+	0, 5, 255, 0, 3, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 0, 3, 255,
+	0, 3, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255,
+	0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255,
+	255, 255, 255, 0, 1, 255, 0, 5, 255, 255, 255, 255, 3, 3, 4, 0, 2, 4, 4, 3, 2, 4, 1, 4,
+	0, 255, 4, 4, 3, 4, 3, 3, 1, 3, 3, 4, 0, 3, 255, 0, 255, 4, 0, 255, 4, 0, 255, 4,
+	0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 4, 0, 255, 255, 0, 2, 4, 2, 2, 4,
+	4, 4, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 0, 1, 1, 0, 4, 4, 0, 4, 255, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 3, 3, 3, 3, 3, 3, 3, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1,
+	0, 255, 255, 0, 255, 255, 0, 3, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255,
+	0, 3, 255, 0, 3, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255,
+	255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 1, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255,
+	0, 255, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255, 255, 255, 255, 2, 3, 1, 2, 2, 2, 0, 3, 2,
+	4, 1, 4, 0, 255, 4, 4, 3, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 0, 255, 2,
+	0, 255, 2, 0, 255, 4, 0, 255, 4, 0, 255, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 1, 1,
+	0, 2, 2, 0, 2, 2, 4, 1, 4, 0, 255, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 255, 2, 0, 255, 2, 0, 255, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 3, 255, 0, 2, 255, 255, 255, 255, 0, 1, 255, 0, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255, 255, 0, 255, 255,
+	0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255,
+};
@@ -0,0 +1,289 @@
+/**
+ * @file proofNumber.c
+ * @brief Contains the implementation of the proof-number search used for forced-win detection.
+ *
+ * Proof-number search grows a game tree best-first, always expanding the "most proving" leaf: the one
+ * whose solution would contribute most to proving or disproving the root. Every node keeps a proof number
+ * (how many leaves still have to be proven for the attacker to win) and a disproof number (how many leaves
+ * have to be disproven to show that the attacker cannot win). The root is solved when one of them reaches 0.
+ *
+ * All nodes live in a statically allocated pool of 'PN_NODE_POOL_SIZE' entries. When the pool runs out,
+ * the search stops and reports an unknown result, so the time and memory spent are strictly bounded.
+ * The board is not stored in the nodes; it is rebuilt by applying the moves along the path from the root.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "proofNumber.h"
+#include "winChecks.h"
+
+#define pnInfinity 0xFFFF /**< Proof or disproof number of a node that can never be (dis)proven */
+#define pnNoNode 0xFFFF /**< Node index used as the parent of the root */
+#define pnUnbounded 0xFF /**< Ply bound of a search that accepts wins of any length */
+
+/**
+ * @brief A single node of the proof-number search tree.
+ *
+ * Children of a node are allocated next to each other, so only the index of the first child and the
+ * number of children have to be stored. 'winDepth' is the number of plies to the completed winning line
+ * and is only valid once the node is proven.
+ */
+typedef struct {
+	uint16_t proof;
+	uint16_t disproof;
+	uint16_t parent;
+	uint16_t firstChild;
+	uint8_t childCount;
+	uint8_t cell;
+	uint8_t winDepth;
+	bool isOr;
+} PnNode;
+
+/**
+ * @brief The node pool shared by all searches.
+ */
+static PnNode nodes[PN_NODE_POOL_SIZE];
+/**
+ * @brief Number of nodes allocated from the pool by the current search.
+ */
+static int nodeCount;
+/**
+ * @brief Number of nodes allocated by all searches of the last 'ProofNumberSolve()'.
+ */
+static unsigned long solveNodeCount;
+/**
+ * @brief Length in plies of the last proven win.
+ */
+static int lastWinDepth;
+
+/**
+ * @brief Adds two proof or disproof numbers.
+ *
+ * Infinity is absorbing and finite sums saturate just below infinity, so that a sum of finite numbers
+ * never looks like a solved node.
+ *
+ * @param a The first number.
+ * @param b The second number.
+ * @return The saturated sum.
+ */
+static uint16_t pnAdd(uint16_t a, uint16_t b) {
+	if (a == pnInfinity || b == pnInfinity)
+		return pnInfinity;
+	uint32_t sum = (uint32_t) a + b;
+	return sum >= pnInfinity ? pnInfinity - 1 : sum;
+}
+
+/**
+ * @brief Initializes the proof and disproof numbers of a freshly created node.
+ *
+ * A node on the ply bound that does not end the game is disproven, as no win below it is short enough.
+ *
+ * @param node The node to evaluate.
+ * @param board The game board with the node's move already applied.
+ * @param size The size of the game board.
+ * @param attacker The character of the player trying to prove a win.
+ * @param isAtBound True if the node lies on the ply bound of the search.
+ */
+static void evaluateLeaf(PnNode *node, char board[maxFieldSize][maxFieldSize], int size, char attacker,
+		bool isAtBound) {
+	char status = checkWin(board, size);
+	node->winDepth = 0;
+	if (status == attacker) {
+		node->proof = 0;
+		node->disproof = pnInfinity;
+	} else if (status != '\0' || isAtBound) {
+		node->proof = pnInfinity;
+		node->disproof = 0;
+	} else {
+		node->proof = 1;
+		node->disproof = 1;
+	}
+}
+
+/**
+ * @brief Creates all children of a leaf node.
+ *
+ * @param index The index of the node to expand.
+ * @param board The game board in the position of the node.
+ * @param size The size of the game board.
+ * @param attacker The character of the player trying to prove a win.
+ * @param defender The character of the other player.
+ * @param isAtBound True if the children lie on the ply bound of the search.
+ * @return True if the node was expanded, false if the node pool is exhausted.
+ */
+static bool expandNode(int index, char board[maxFieldSize][maxFieldSize], int size, char attacker,
+		char defender, bool isAtBound) {
+	PnNode *node = &nodes[index];
+	char toPlace = node->isOr ? attacker : defender;
+	int emptyCount = 0;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (board[i][j] == '\0')
+				emptyCount++;
+		}
+	}
+	if (nodeCount + emptyCount > PN_NODE_POOL_SIZE)
+		return false;
+
+	node->firstChild = nodeCount;
+	node->childCount = emptyCount;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (board[i][j] != '\0')
+				continue;
+			PnNode *child = &nodes[nodeCount++];
+			child->parent = index;
+			child->firstChild = pnNoNode;
+			child->childCount = 0;
+			child->cell = i * maxFieldSize + j;
+			child->isOr = !node->isOr;
+			board[i][j] = toPlace;
+			evaluateLeaf(child, board, size, attacker, isAtBound);
+			board[i][j] = '\0';
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Recomputes the proof and disproof numbers of an expanded node from its children.
+ *
+ * At an OR node (attacker to move) one proven child is enough, at an AND node (defender to move)
+ * all children have to be proven. The win depth follows the same rule: the attacker picks the fastest
+ * proven win, while the defender delays the loss as long as possible.
+ *
+ * @param node The node to update.
+ */
+static void updateNode(PnNode *node) {
+	PnNode *child = &nodes[node->firstChild];
+	if (node->isOr) {
+		node->proof = pnInfinity;
+		node->disproof = 0;
+		node->winDepth = 0xFF;
+		for (int i = 0; i < node->childCount; i++, child++) {
+			node->proof = min(node->proof, child->proof);
+			node->disproof = pnAdd(node->disproof, child->disproof);
+			if (child->proof == 0)
+				node->winDepth = min(node->winDepth, child->winDepth + 1);
+		}
+	} else {
+		node->proof = 0;
+		node->disproof = pnInfinity;
+		node->winDepth = 0;
+		for (int i = 0; i < node->childCount; i++, child++) {
+			node->proof = pnAdd(node->proof, child->proof);
+			node->disproof = min(node->disproof, child->disproof);
+			node->winDepth = max(node->winDepth, child->winDepth + 1);
+		}
+	}
+}
+
+/**
+ * @brief Runs a proof-number search trying to prove a forced win for 'attacker'.
+ *
+ * @param board The current game board. It is restored before returning.
+ * @param size The size of the game board.
+ * @param attacker The character of the player trying to prove a win.
+ * @param attackerToMove True if the attacker makes the next move (the root is an OR node).
+ * @param maxPlies Only wins completed within this many plies count, 'pnUnbounded' for any win.
+ * @return True if the root was proven, false if it was disproven or the node pool ran out.
+ */
+static bool proveWin(char board[maxFieldSize][maxFieldSize], int size, char attacker, bool attackerToMove,
+		int maxPlies) {
+	char defender = attacker == firstPlayerChar ? secondPlayerChar : firstPlayerChar;
+	PnNode *root = &nodes[0];
+	root->proof = 1;
+	root->disproof = 1;
+	root->parent = pnNoNode;
+	root->firstChild = pnNoNode;
+	root->childCount = 0;
+	root->isOr = attackerToMove;
+	nodeCount = 1;
+
+	while (root->proof != 0 && root->disproof != 0) {
+		int path[maxFieldSize * maxFieldSize];
+		int pathLength = 0;
+		int current = 0;
+
+		// Descend to the most proving leaf, replaying its moves on the board
+		while (nodes[current].childCount > 0) {
+			PnNode *node = &nodes[current];
+			int best = node->firstChild;
+			for (int i = 1; i < node->childCount; i++) {
+				PnNode *child = &nodes[node->firstChild + i];
+				if (node->isOr ? child->proof < nodes[best].proof : child->disproof < nodes[best].disproof)
+					best = node->firstChild + i;
+			}
+			int cell = nodes[best].cell;
+			board[cell / maxFieldSize][cell % maxFieldSize] = node->isOr ? attacker : defender;
+			path[pathLength++] = cell;
+			current = best;
+		}
+
+		bool expanded = expandNode(current, board, size, attacker, defender, pathLength + 1 >= maxPlies);
+
+		while (pathLength > 0) {
+			int cell = path[--pathLength];
+			board[cell / maxFieldSize][cell % maxFieldSize] = '\0';
+		}
+		if (!expanded)
+			break;
+
+		for (int i = current; i != pnNoNode; i = nodes[i].parent)
+			updateNode(&nodes[i]);
+	}
+
+	solveNodeCount += nodeCount;
+	return root->proof == 0;
+}
+
+PnResult ProofNumberSolve(char board[maxFieldSize][maxFieldSize], int size, char toMove,
+		int *bestX, int *bestY) {
+	char opponent = toMove == firstPlayerChar ? secondPlayerChar : firstPlayerChar;
+	*bestX = -1;
+	*bestY = -1;
+	solveNodeCount = 0;
+
+	char status = checkWin(board, size);
+	if (status != '\0') {
+		lastWinDepth = 0;
+		return status == toMove ? pnProvenWin : (status == opponent ? pnProvenLoss : pnProvenDraw);
+	}
+
+	// The search stops at the first proof, which need not be the shortest win. Each proven win bounds
+	// the next search by two plies less, as the side to move completes lines on every other ply, until
+	// no shorter win is proven or the pool runs out.
+	int maxPlies = pnUnbounded;
+	while (maxPlies > 0 && proveWin(board, size, toMove, true, maxPlies)) {
+		PnNode *root = &nodes[0];
+		int best = -1;
+		for (int i = root->firstChild; i < root->firstChild + root->childCount; i++) {
+			if (nodes[i].proof == 0 && (best < 0 || nodes[i].winDepth < nodes[best].winDepth))
+				best = i;
+		}
+		*bestX = nodes[best].cell / maxFieldSize;
+		*bestY = nodes[best].cell % maxFieldSize;
+		lastWinDepth = root->winDepth;
+		maxPlies = lastWinDepth - 2;
+	}
+	if (*bestX >= 0)
+		return pnProvenWin;
+
+	bool cannotWin = nodes[0].disproof == 0;
+	if (proveWin(board, size, opponent, false, pnUnbounded)) {
+		lastWinDepth = nodes[0].winDepth;
+		return pnProvenLoss;
+	}
+	if (cannotWin && nodes[0].disproof == 0)
+		return pnProvenDraw;
+
+	return pnUnknown;
+}
+
+unsigned long ProofNumberNodeCount(void) {
+	return solveNodeCount;
+}
+
+int ProofNumberWinDepth(void) {
+	return lastWinDepth;
+}
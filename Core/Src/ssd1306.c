@@ -3,24 +3,59 @@
 #include <stdlib.h>
 #include <string.h>  // For memcpy
 
+#ifdef SSD1306_USE_DMA
+// Set while ssd1306_UpdateScreenAsync() streams the screenbuffer
+static volatile uint8_t SSD1306_Busy = 0;
+#endif
+
+/* Wait for a running ssd1306_UpdateScreenAsync(), as the bus carries one transfer at a time */
+static inline void ssd1306_WaitIdle(void) {
+#ifdef SSD1306_USE_DMA
+    while (SSD1306_Busy) {
+    }
+#endif
+}
+
 #if defined(SSD1306_USE_I2C)
 
+// Bus cost of a window in bytes, against one byte of data: a command transaction
+// (address, control and 6 bytes) and the address and control of the data transaction
+#define SSD1306_WINDOW_COST 10
+
 void ssd1306_Reset(void) {
     /* for I2C - do nothing */
 }
 
-// Send a byte to the command register
-void ssd1306_WriteCommand(uint8_t byte) {
-    HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &byte, 1, HAL_MAX_DELAY);
+// Send a sequence of bytes to the command register in one transaction
+void ssd1306_WriteCommands(const uint8_t* cmds, size_t n) {
+    ssd1306_WaitIdle();
+    HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, (uint8_t*) cmds, n, HAL_MAX_DELAY);
 }
 
 // Send data
 void ssd1306_WriteData(uint8_t* buffer, size_t buff_size) {
+    ssd1306_WaitIdle();
     HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x40, 1, buffer, buff_size, HAL_MAX_DELAY);
 }
 
+#ifdef SSD1306_USE_DMA
+/* Start sending to the command or data register by DMA; HAL_I2C_MemTxCpltCallback() follows */
+static HAL_StatusTypeDef ssd1306_WriteDMA(uint8_t isData, uint8_t* buffer, size_t buff_size) {
+    return HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, isData ? 0x40 : 0x00, 1,
+                                 buffer, buff_size);
+}
+
+/* Every transaction ends with a stop condition, so there is nothing to release */
+static inline void ssd1306_ReleaseBus(void) {
+}
+#endif
+
 #elif defined(SSD1306_USE_SPI)
 
+// Bus cost of a window in bytes, against one byte of data: 6 bytes of commands and
+// about 10 byte times (8 us at 10 MHz) to switch DC and restart the DMA twice
+#define SSD1306_WINDOW_COST 16
+
 void ssd1306_Reset(void) {
     // CS = High (not selected)
     HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET);
@@ -32,134 +67,394 @@ void ssd1306_Reset(void) {
     HAL_Delay(10);
 }
 
-// Send a byte to the command register
-void ssd1306_WriteCommand(uint8_t byte) {
+// Send a sequence of bytes to the command register in one transaction
+void ssd1306_WriteCommands(const uint8_t* cmds, size_t n) {
+    ssd1306_WaitIdle();
     HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_RESET); // select OLED
     HAL_GPIO_WritePin(SSD1306_DC_Port, SSD1306_DC_Pin, GPIO_PIN_RESET); // command
-    HAL_SPI_Transmit(&SSD1306_SPI_PORT, (uint8_t *) &byte, 1, HAL_MAX_DELAY);
+    HAL_SPI_Transmit(&SSD1306_SPI_PORT, (uint8_t *) cmds, n, HAL_MAX_DELAY);
     HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET); // un-select OLED
 }
 
 // Send data
 void ssd1306_WriteData(uint8_t* buffer, size_t buff_size) {
+    ssd1306_WaitIdle();
     HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_RESET); // select OLED
     HAL_GPIO_WritePin(SSD1306_DC_Port, SSD1306_DC_Pin, GPIO_PIN_SET); // data
     HAL_SPI_Transmit(&SSD1306_SPI_PORT, buffer, buff_size, HAL_MAX_DELAY);
     HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET); // un-select OLED
 }
 
+#ifdef SSD1306_USE_DMA
+/*
+ * Start sending to the command or data register by DMA; HAL_SPI_TxCpltCallback() follows
+ * once the last byte has left the shift register. The OLED stays selected until the
+ * flush ends, and DC only changes between the window commands and the data
+ */
+static HAL_StatusTypeDef ssd1306_WriteDMA(uint8_t isData, uint8_t* buffer, size_t buff_size) {
+    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_RESET); // select OLED
+    HAL_GPIO_WritePin(SSD1306_DC_Port, SSD1306_DC_Pin, isData ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    return HAL_SPI_Transmit_DMA(&SSD1306_SPI_PORT, buffer, buff_size);
+}
+
+/* Un-select the OLED at the end of ssd1306_UpdateScreenAsync() */
+static inline void ssd1306_ReleaseBus(void) {
+    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET);
+}
+#endif
+
 #else
 #error "You should define SSD1306_USE_SPI or SSD1306_USE_I2C macro"
 #endif
 
+// Send a byte to the command register
+void ssd1306_WriteCommand(uint8_t byte) {
+    ssd1306_WriteCommands(&byte, 1);
+}
 
 // Screenbuffer
 static uint8_t SSD1306_Buffer[SSD1306_BUFFER_SIZE];
 
+#ifdef SSD1306_DOUBLE_BUFFER
+// Front buffer: the frame the last flush sent. The screenbuffer is the back buffer that
+// is drawn on; a flush copies its changes here and sends them from here, so the DMA
+// never reads a frame that is being drawn
+static uint8_t SSD1306_Front[SSD1306_BUFFER_SIZE];
+#define SSD1306_SENT_BUFFER SSD1306_Front
+// Pages whose changed columns are sent without comparing with the front buffer, one bit
+// per page: those marked by ssd1306_MarkDirty() and those a failed transfer left
+static uint32_t SSD1306_ForcedPages;
+#else
+#define SSD1306_SENT_BUFFER SSD1306_Buffer
+#endif
+
 // Screen object
 static SSD1306_t SSD1306;
 
+// Changed columns of every page since the last flush, from start up to but
+// excluding end; empty when start >= end
+static uint8_t SSD1306_DirtyStart[SSD1306_PAGES];
+static uint8_t SSD1306_DirtyEnd[SSD1306_PAGES];
+
+/* Add columns x1 to x2 (included) of a page to the columns sent by the next flush */
+static inline void ssd1306_MarkColumns(uint8_t x1, uint8_t x2, uint8_t page) {
+    if (SSD1306_DirtyStart[page] >= SSD1306_DirtyEnd[page]) {
+        SSD1306_DirtyStart[page] = x1;
+        SSD1306_DirtyEnd[page] = x2 + 1;
+        return;
+    }
+    if (x1 < SSD1306_DirtyStart[page]) {
+        SSD1306_DirtyStart[page] = x1;
+    }
+    if (x2 >= SSD1306_DirtyEnd[page]) {
+        SSD1306_DirtyEnd[page] = x2 + 1;
+    }
+}
+
+/*
+ * Widen the ranges from the first to the last changed page to whole pages when one
+ * window and one data transaction for all of them put fewer bytes on the bus than a
+ * window per page. Each page costs a window (SSD1306_WINDOW_COST) and its columns
+ */
+static void ssd1306_MergePages(uint8_t* start, uint8_t* end) {
+    uint8_t first = SSD1306_PAGES;
+    uint8_t last = 0;
+    uint32_t perPage = 0;
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (start[page] < end[page]) {
+            if (first == SSD1306_PAGES) {
+                first = page;
+            }
+            last = page;
+            perPage += SSD1306_WINDOW_COST + end[page] - start[page];
+        }
+    }
+    if (first == SSD1306_PAGES || SSD1306_WINDOW_COST + (uint32_t) SSD1306_WIDTH * (last - first + 1) > perPage) {
+        return;
+    }
+    for (uint8_t page = first; page <= last; page++) {
+        start[page] = 0;
+        end[page] = SSD1306_WIDTH;
+    }
+}
+
+/* Last page sent with the given one: whole pages in a row are contiguous in the
+ * screenbuffer and go in one transaction */
+static uint8_t ssd1306_LastPage(const uint8_t* start, const uint8_t* end, uint8_t page) {
+    if (start[page] != 0 || end[page] != SSD1306_WIDTH) {
+        return page;
+    }
+    while (page + 1 < SSD1306_PAGES && start[page + 1] == 0 && end[page + 1] == SSD1306_WIDTH) {
+        page++;
+    }
+    return page;
+}
+
+/* Write the commands limiting the next data to columns start up to but excluding
+ * end, of pages first to last */
+static void ssd1306_SetWindow(uint8_t commands[6], uint8_t start, uint8_t end, uint8_t first, uint8_t last) {
+    commands[0] = 0x21; // Set the column address window.
+    commands[1] = SSD1306_X_OFFSET_COLUMN + start;
+    commands[2] = SSD1306_X_OFFSET_COLUMN + end - 1;
+    commands[3] = 0x22; // Set the page address window.
+    commands[4] = first;
+    commands[5] = last;
+}
+
+#ifdef SSD1306_USE_DMA
+// Columns of every page that the running ssd1306_UpdateScreenAsync() has not sent yet,
+// as in SSD1306_DirtyStart and SSD1306_DirtyEnd. Only the transfer interrupts change them while SSD1306_Busy is set
+static uint8_t SSD1306_AsyncStart[SSD1306_PAGES];
+static uint8_t SSD1306_AsyncEnd[SSD1306_PAGES];
+static uint8_t SSD1306_AsyncPage;       // First page being sent
+static uint8_t SSD1306_AsyncLast;       // Last page being sent
+static uint8_t SSD1306_AsyncIsData;     // 0: the window commands are in flight, 1: the data
+static uint8_t SSD1306_AsyncCommands[6];
+
+/* Add the columns a failed ssd1306_UpdateScreenAsync() did not send back to the changes */
+static void ssd1306_RestoreUnsent(void) {
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (SSD1306_AsyncStart[page] < SSD1306_AsyncEnd[page]) {
+            ssd1306_MarkColumns(SSD1306_AsyncStart[page], SSD1306_AsyncEnd[page] - 1, page);
+#ifdef SSD1306_DOUBLE_BUFFER
+            SSD1306_ForcedPages |= 1UL << page;
+#endif
+        }
+    }
+    memset(SSD1306_AsyncStart, 0, sizeof(SSD1306_AsyncStart));
+    memset(SSD1306_AsyncEnd, 0, sizeof(SSD1306_AsyncEnd));
+}
+#endif
+
+/*
+ * Prepare the ranges of a flush. With the double buffer, the columns at both ends of
+ * a range that the display already shows are dropped by comparing the back and front
+ * buffers, and the rest is copied to the front buffer that is sent
+ */
+static void ssd1306_PrepareFlush(uint8_t* start, uint8_t* end) {
+#ifdef SSD1306_DOUBLE_BUFFER
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        const uint8_t* back = &SSD1306_Buffer[SSD1306_WIDTH * page];
+        const uint8_t* front = &SSD1306_Front[SSD1306_WIDTH * page];
+        if (SSD1306_ForcedPages & (1UL << page)) {
+            continue;
+        }
+        while (start[page] < end[page] && back[start[page]] == front[start[page]]) {
+            start[page]++;
+        }
+        while (end[page] > start[page] && back[end[page] - 1] == front[end[page] - 1]) {
+            end[page]--;
+        }
+    }
+    SSD1306_ForcedPages = 0;
+#endif
+
+    ssd1306_MergePages(start, end);
+
+#ifdef SSD1306_DOUBLE_BUFFER
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (start[page] < end[page]) {
+            memcpy(&SSD1306_Front[SSD1306_WIDTH * page + start[page]],
+                   &SSD1306_Buffer[SSD1306_WIDTH * page + start[page]], end[page] - start[page]);
+        }
+    }
+#endif
+}
+
+/* Add a rectangle (including border) to the changes; returns 0 if it is off the screen */
+static uint8_t ssd1306_MarkArea(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+    if (x1 > x2 || y1 > y2 || x1 >= SSD1306_WIDTH || y1 >= SSD1306_HEIGHT) {
+        return 0;
+    }
+    if (x2 >= SSD1306_WIDTH) {
+        x2 = SSD1306_WIDTH - 1;
+    }
+    if (y2 >= SSD1306_HEIGHT) {
+        y2 = SSD1306_HEIGHT - 1;
+    }
+    for (uint8_t page = y1 / 8; page <= y2 / 8; page++) {
+        ssd1306_MarkColumns(x1, x2, page);
+    }
+    return 1;
+}
+
+/* Mark a rectangle (including border) as changed, so the next flush sends it */
+void ssd1306_MarkDirty(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+    if (!ssd1306_MarkArea(x1, y1, x2, y2)) {
+        return;
+    }
+#ifdef SSD1306_DOUBLE_BUFFER
+    // Sent even where the front buffer matches, as the display RAM may differ
+    if (y2 >= SSD1306_HEIGHT) {
+        y2 = SSD1306_HEIGHT - 1;
+    }
+    for (uint8_t page = y1 / 8; page <= y2 / 8; page++) {
+        SSD1306_ForcedPages |= 1UL << page;
+    }
+#endif
+}
+
+/* Check whether the screenbuffer has changes that were not sent yet */
+uint8_t ssd1306_IsDirty(void) {
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (SSD1306_DirtyStart[page] < SSD1306_DirtyEnd[page]) {
+            return 1;
+        }
+#ifdef SSD1306_USE_DMA
+        if (!SSD1306_Busy && SSD1306_AsyncStart[page] < SSD1306_AsyncEnd[page]) {
+            return 1;
+        }
+#endif
+    }
+    return 0;
+}
+
+/* Forget all changes, after they were sent */
+static void ssd1306_ClearDirty(void) {
+    memset(SSD1306_DirtyStart, 0, sizeof(SSD1306_DirtyStart));
+    memset(SSD1306_DirtyEnd, 0, sizeof(SSD1306_DirtyEnd));
+}
+
 /* Fills the Screenbuffer with values from a given buffer of a fixed length */
-SSD1306_Error_t ssd1306_FillBuffer(uint8_t* buf, uint32_t len) {
+SSD1306_Error_t ssd1306_FillBuffer(const uint8_t* buf, uint32_t len) {
     SSD1306_Error_t ret = SSD1306_ERR;
     if (len <= SSD1306_BUFFER_SIZE) {
-        memcpy(SSD1306_Buffer,buf,len);
+        // Copy and mark only the columns of every page that change, so copying
+        // a prepared image over a similar screen leaves little to send
+        for (uint32_t start = 0; start < len; start += SSD1306_WIDTH) {
+            const uint8_t page = start / SSD1306_WIDTH;
+            int16_t first = 0;
+            int16_t last = ((len - start < SSD1306_WIDTH) ? len - start : SSD1306_WIDTH) - 1;
+            while (first <= last && SSD1306_Buffer[start + first] == buf[start + first]) {
+                first++;
+            }
+            while (last > first && SSD1306_Buffer[start + last] == buf[start + last]) {
+                last--;
+            }
+            if (first <= last) {
+                memcpy(&SSD1306_Buffer[start + first], &buf[start + first], last - first + 1);
+                ssd1306_MarkColumns(first, last, page);
+            }
+        }
         ret = SSD1306_OK;
     }
     return ret;
 }
 
-/* Initialize the oled screen */
-void ssd1306_Init(void) {
-    // Reset OLED
-    ssd1306_Reset();
-
-    // Wait for the screen to boot
-    HAL_Delay(100);
+/* Copies the Screenbuffer into a given buffer of a fixed length */
+SSD1306_Error_t ssd1306_ReadBuffer(uint8_t* buf, uint32_t len) {
+    SSD1306_Error_t ret = SSD1306_ERR;
+    if (len <= SSD1306_BUFFER_SIZE) {
+        memcpy(buf, SSD1306_Buffer, len);
+        ret = SSD1306_OK;
+    }
+    return ret;
+}
 
-    // Init OLED
-    ssd1306_SetDisplayOn(0); //display off
+// Commands of ssd1306_Init(), sent in one transaction
+static const uint8_t SSD1306_InitCommands[] = {
+    0xAE, //display off
 
-    ssd1306_WriteCommand(0x20); //Set Memory Addressing Mode
-    ssd1306_WriteCommand(0x00); // 00b,Horizontal Addressing Mode; 01b,Vertical Addressing Mode;
-                                // 10b,Page Addressing Mode (RESET); 11b,Invalid
+    0x20, //Set Memory Addressing Mode
+    0x00, // 00b,Horizontal Addressing Mode; 01b,Vertical Addressing Mode;
+          // 10b,Page Addressing Mode (RESET); 11b,Invalid
 
-    ssd1306_WriteCommand(0xB0); //Set Page Start Address for Page Addressing Mode,0-7
+    0xB0, //Set Page Start Address for Page Addressing Mode,0-7
 
 #ifdef SSD1306_MIRROR_VERT
-    ssd1306_WriteCommand(0xC0); // Mirror vertically
+    0xC0, // Mirror vertically
 #else
-    ssd1306_WriteCommand(0xC8); //Set COM Output Scan Direction
+    0xC8, //Set COM Output Scan Direction
 #endif
 
-    ssd1306_WriteCommand(0x00); //---set low column address
-    ssd1306_WriteCommand(0x10); //---set high column address
+    0x00, //---set low column address
+    0x10, //---set high column address
 
-    ssd1306_WriteCommand(0x40); //--set start line address - CHECK
+    0x40, //--set start line address - CHECK
 
-    ssd1306_SetContrast(0xFF);
+    0x81, //--set contrast control register
+    0xFF,
 
 #ifdef SSD1306_MIRROR_HORIZ
-    ssd1306_WriteCommand(0xA0); // Mirror horizontally
+    0xA0, // Mirror horizontally
 #else
-    ssd1306_WriteCommand(0xA1); //--set segment re-map 0 to 127 - CHECK
+    0xA1, //--set segment re-map 0 to 127 - CHECK
 #endif
 
 #ifdef SSD1306_INVERSE_COLOR
-    ssd1306_WriteCommand(0xA7); //--set inverse color
+    0xA7, //--set inverse color
 #else
-    ssd1306_WriteCommand(0xA6); //--set normal color
+    0xA6, //--set normal color
 #endif
 
 // Set multiplex ratio.
 #if (SSD1306_HEIGHT == 128)
     // Found in the Luma Python lib for SH1106.
-    ssd1306_WriteCommand(0xFF);
+    0xFF,
 #else
-    ssd1306_WriteCommand(0xA8); //--set multiplex ratio(1 to 64) - CHECK
+    0xA8, //--set multiplex ratio(1 to 64) - CHECK
 #endif
 
 #if (SSD1306_HEIGHT == 32)
-    ssd1306_WriteCommand(0x1F); //
+    0x1F, //
 #elif (SSD1306_HEIGHT == 64)
-    ssd1306_WriteCommand(0x3F); //
+    0x3F, //
 #elif (SSD1306_HEIGHT == 128)
-    ssd1306_WriteCommand(0x3F); // Seems to work for 128px high displays too.
+    0x3F, // Seems to work for 128px high displays too.
 #else
 #error "Only 32, 64, or 128 lines of height are supported!"
 #endif
 
-    ssd1306_WriteCommand(0xA4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
+    0xA4, //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
 
-    ssd1306_WriteCommand(0xD3); //-set display offset - CHECK
-    ssd1306_WriteCommand(0x00); //-not offset
+    0xD3, //-set display offset - CHECK
+    0x00, //-not offset
 
-    ssd1306_WriteCommand(0xD5); //--set display clock divide ratio/oscillator frequency
-    ssd1306_WriteCommand(0xF0); //--set divide ratio
+    0xD5, //--set display clock divide ratio/oscillator frequency
+    0xF0, //--set divide ratio
 
-    ssd1306_WriteCommand(0xD9); //--set pre-charge period
-    ssd1306_WriteCommand(0x22); //
+    0xD9, //--set pre-charge period
+    0x22, //
 
-    ssd1306_WriteCommand(0xDA); //--set com pins hardware configuration - CHECK
+    0xDA, //--set com pins hardware configuration - CHECK
 #if (SSD1306_HEIGHT == 32)
-    ssd1306_WriteCommand(0x02);
+    0x02,
 #elif (SSD1306_HEIGHT == 64)
-    ssd1306_WriteCommand(0x12);
+    0x12,
 #elif (SSD1306_HEIGHT == 128)
-    ssd1306_WriteCommand(0x12);
+    0x12,
 #else
 #error "Only 32, 64, or 128 lines of height are supported!"
 #endif
 
-    ssd1306_WriteCommand(0xDB); //--set vcomh
-    ssd1306_WriteCommand(0x20); //0x20,0.77xVcc
+    0xDB, //--set vcomh
+    0x20, //0x20,0.77xVcc
+
+    0x8D, //--set DC-DC enable
+    0x14, //
+    0xAF, //--turn on SSD1306 panel
+};
+
+/* Initialize the oled screen */
+void ssd1306_Init(void) {
+    // Reset OLED
+    ssd1306_Reset();
+
+    // Wait for the screen to boot
+    HAL_Delay(100);
 
-    ssd1306_WriteCommand(0x8D); //--set DC-DC enable
-    ssd1306_WriteCommand(0x14); //
-    ssd1306_SetDisplayOn(1); //--turn on SSD1306 panel
+    // Init OLED
+    ssd1306_WriteCommands(SSD1306_InitCommands, sizeof(SSD1306_InitCommands));
+    SSD1306.DisplayOn = 1;
+#ifdef SSD1306_INVERSE_COLOR
+    SSD1306.Inverted = 1;
+#else
+    SSD1306.Inverted = 0;
+#endif
 
-    // Clear screen
+    // Clear screen. The display RAM is undefined after reset, so send the whole buffer
     ssd1306_Fill(Black);
+    ssd1306_MarkDirty(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1);
 
     // Flush buffer to screen
     ssd1306_UpdateScreen();
@@ -171,25 +466,226 @@ void ssd1306_Init(void) {
     SSD1306.Initialized = 1;
 }
 
+/*
+ * Set or clear the pixels of columns x1 to x2 and rows y1 to y2 (all included and on
+ * the screen) a byte per column and page: whole pages are set by memset, the top and
+ * bottom pages with a mask. Only the columns that change are marked
+ */
+static void ssd1306_FillArea(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
+    for (uint8_t page = y1 / 8; page <= y2 / 8; page++) {
+        uint8_t* row = &SSD1306_Buffer[SSD1306_WIDTH * page];
+        uint8_t mask = 0xFF;
+        if (page == y1 / 8) {
+            mask &= 0xFF << (y1 % 8);
+        }
+        if (page == y2 / 8) {
+            mask &= 0xFF >> (7 - (y2 % 8));
+        }
+
+        int16_t first = x1;
+        int16_t last = x2;
+        if (mask == 0xFF) {
+            const uint8_t value = (color == Black) ? 0x00 : 0xFF;
+            while (first <= last && row[first] == value) {
+                first++;
+            }
+            while (last > first && row[last] == value) {
+                last--;
+            }
+            if (first <= last) {
+                memset(&row[first], value, last - first + 1);
+            }
+        } else {
+            first = -1;
+            for (int16_t x = x1; x <= x2; x++) {
+                const uint8_t value = (color == White) ? (row[x] | mask) : (row[x] & ~mask);
+                if (value != row[x]) {
+                    row[x] = value;
+                    if (first < 0) {
+                        first = x;
+                    }
+                    last = x;
+                }
+            }
+        }
+        if (first >= 0 && first <= last) {
+            ssd1306_MarkColumns(first, last, page);
+        }
+    }
+}
+
 /* Fill the whole screen with the given color */
 void ssd1306_Fill(SSD1306_COLOR color) {
-    memset(SSD1306_Buffer, (color == Black) ? 0x00 : 0xFF, sizeof(SSD1306_Buffer));
+    // Only the columns that change need to be sent
+    ssd1306_FillArea(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1, color);
 }
 
-/* Write the screenbuffer with changed to the screen */
+/* Write the changed parts of the screenbuffer to the screen */
 void ssd1306_UpdateScreen(void) {
-    // Write data to each page of RAM. Number of pages
+    // Write data to each changed page of RAM. Number of pages
     // depends on the screen height:
     //
     //  * 32px   ==  4 pages
     //  * 64px   ==  8 pages
     //  * 128px  ==  16 pages
-    for(uint8_t i = 0; i < SSD1306_HEIGHT/8; i++) {
-        ssd1306_WriteCommand(0xB0 + i); // Set the current RAM page address.
-        ssd1306_WriteCommand(0x00 + SSD1306_X_OFFSET_LOWER);
-        ssd1306_WriteCommand(0x10 + SSD1306_X_OFFSET_UPPER);
-        ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH*i],SSD1306_WIDTH);
+    //
+    // The column and page address commands limit the write to the changed
+    // columns; they apply in the horizontal addressing mode set by ssd1306_Init(),
+    // which wraps to the next page at the end of the window. A run of whole pages,
+    // up to the full frame, is therefore one window and one data transaction.
+#ifdef SSD1306_USE_DMA
+    ssd1306_WaitIdle();
+    ssd1306_RestoreUnsent();
+#endif
+    ssd1306_PrepareFlush(SSD1306_DirtyStart, SSD1306_DirtyEnd);
+    for(uint8_t i = 0; i < SSD1306_PAGES; i++) {
+        uint8_t start = SSD1306_DirtyStart[i];
+        uint8_t end = SSD1306_DirtyEnd[i];
+        if (start >= end) {
+            continue;
+        }
+        uint8_t last = ssd1306_LastPage(SSD1306_DirtyStart, SSD1306_DirtyEnd, i);
+        uint8_t window[6];
+        ssd1306_SetWindow(window, start, end, i, last);
+        ssd1306_WriteCommands(window, sizeof(window));
+        ssd1306_WriteData(&SSD1306_SENT_BUFFER[SSD1306_WIDTH*i + start], SSD1306_WIDTH*(last - i) + end - start);
+        i = last;
+    }
+    ssd1306_ClearDirty();
+}
+
+/* Called when ssd1306_UpdateScreenAsync() has finished. Override it to be notified */
+__weak void ssd1306_UpdateScreenCpltCallback(SSD1306_Error_t status) {
+    (void) status;
+}
+
+#ifdef SSD1306_USE_DMA
+
+/* Start the next transfer of ssd1306_UpdateScreenAsync(), or finish it when every page is sent */
+static void ssd1306_AsyncNext(void) {
+    while (SSD1306_AsyncPage < SSD1306_PAGES &&
+           SSD1306_AsyncStart[SSD1306_AsyncPage] >= SSD1306_AsyncEnd[SSD1306_AsyncPage]) {
+        SSD1306_AsyncPage++;
+    }
+    if (SSD1306_AsyncPage == SSD1306_PAGES) {
+        ssd1306_ReleaseBus();
+        SSD1306_Busy = 0;
+        ssd1306_UpdateScreenCpltCallback(SSD1306_OK);
+        return;
+    }
+
+    uint8_t page = SSD1306_AsyncPage;
+    uint8_t start = SSD1306_AsyncStart[page];
+    uint8_t end = SSD1306_AsyncEnd[page];
+    HAL_StatusTypeDef status;
+    if (!SSD1306_AsyncIsData) {
+        SSD1306_AsyncLast = ssd1306_LastPage(SSD1306_AsyncStart, SSD1306_AsyncEnd, page);
+        ssd1306_SetWindow(SSD1306_AsyncCommands, start, end, page, SSD1306_AsyncLast);
+        status = ssd1306_WriteDMA(0, SSD1306_AsyncCommands, sizeof(SSD1306_AsyncCommands));
+    } else {
+        status = ssd1306_WriteDMA(1, &SSD1306_SENT_BUFFER[SSD1306_WIDTH * page + start],
+                                  SSD1306_WIDTH * (SSD1306_AsyncLast - page) + end - start);
+    }
+    if (status != HAL_OK) {
+        ssd1306_ReleaseBus();
+        SSD1306_Busy = 0;
+        ssd1306_UpdateScreenCpltCallback(SSD1306_ERR);
+    }
+}
+
+/* A transfer of ssd1306_UpdateScreenAsync() has completed: start the next one */
+static void ssd1306_AsyncTransferDone(void) {
+    if (!SSD1306_Busy) {
+        return;
+    }
+    if (SSD1306_AsyncIsData) {
+        for (; SSD1306_AsyncPage <= SSD1306_AsyncLast; SSD1306_AsyncPage++) {
+            SSD1306_AsyncStart[SSD1306_AsyncPage] = 0;
+            SSD1306_AsyncEnd[SSD1306_AsyncPage] = 0;
+        }
+    }
+    SSD1306_AsyncIsData = !SSD1306_AsyncIsData;
+    ssd1306_AsyncNext();
+}
+
+/* A failed transfer stops ssd1306_UpdateScreenAsync(); the next flush resends what is left */
+static void ssd1306_AsyncTransferFailed(void) {
+    if (!SSD1306_Busy) {
+        return;
     }
+    ssd1306_ReleaseBus();
+    SSD1306_Busy = 0;
+    ssd1306_UpdateScreenCpltCallback(SSD1306_ERR);
+}
+
+#if defined(SSD1306_USE_I2C)
+/* The transfers of ssd1306_UpdateScreenAsync() complete in the I2C interrupt */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    if (hi2c == &SSD1306_I2C_PORT) {
+        ssd1306_AsyncTransferDone();
+    }
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+    if (hi2c == &SSD1306_I2C_PORT) {
+        ssd1306_AsyncTransferFailed();
+    }
+}
+#elif defined(SSD1306_USE_SPI)
+/* The transfers of ssd1306_UpdateScreenAsync() complete in the DMA interrupt */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+    if (hspi == &SSD1306_SPI_PORT) {
+        ssd1306_AsyncTransferDone();
+    }
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+    if (hspi == &SSD1306_SPI_PORT) {
+        ssd1306_AsyncTransferFailed();
+    }
+}
+#endif
+
+#endif
+
+/* Start writing the changed parts of the screenbuffer to the screen without waiting */
+SSD1306_Error_t ssd1306_UpdateScreenAsync(void) {
+#ifdef SSD1306_USE_DMA
+    // Claim the bus and take the changes with interrupts masked: a flush or a blocking
+    // transfer from an interrupt must not start in between, nor mark changes that are lost
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (SSD1306_Busy) {
+        __set_PRIMASK(primask);
+        return SSD1306_BUSY;
+    }
+    SSD1306_Busy = 1;
+
+    // Drawing may go on during the transfer; what it changes is marked for the next flush
+    ssd1306_RestoreUnsent();
+    memcpy(SSD1306_AsyncStart, SSD1306_DirtyStart, sizeof(SSD1306_AsyncStart));
+    memcpy(SSD1306_AsyncEnd, SSD1306_DirtyEnd, sizeof(SSD1306_AsyncEnd));
+    ssd1306_ClearDirty();
+    __set_PRIMASK(primask);
+
+    ssd1306_PrepareFlush(SSD1306_AsyncStart, SSD1306_AsyncEnd);
+    SSD1306_AsyncPage = 0;
+    SSD1306_AsyncIsData = 0;
+    ssd1306_AsyncNext();
+#else
+    ssd1306_UpdateScreen();
+    ssd1306_UpdateScreenCpltCallback(SSD1306_OK);
+#endif
+    return SSD1306_OK;
+}
+
+/* Check whether ssd1306_UpdateScreenAsync() is still sending */
+uint8_t ssd1306_IsBusy(void) {
+#ifdef SSD1306_USE_DMA
+    return SSD1306_Busy;
+#else
+    return 0;
+#endif
 }
 
 /*
@@ -205,10 +701,33 @@ void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
     }
 
     // Draw in the right color
+    uint8_t* byte = &SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH];
+    uint8_t value;
     if(color == White) {
-        SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] |= 1 << (y % 8);
+        value = *byte | (1 << (y % 8));
     } else {
-        SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8));
+        value = *byte & ~(1 << (y % 8));
+    }
+
+    // Only a changed byte needs to be sent
+    if (value != *byte) {
+        *byte = value;
+        ssd1306_MarkColumns(x, x, y / 8);
+    }
+}
+
+/*
+ * Write the rows of mask in a column of the screenbuffer from bits: the low byte
+ * into the page, the high byte into the next one. Only changed bytes are marked
+ */
+static inline void ssd1306_BlitColumn(uint8_t x, uint8_t page, uint16_t mask, uint16_t bits) {
+    for (; mask != 0; mask >>= 8, bits >>= 8, page++) {
+        uint8_t* byte = &SSD1306_Buffer[x + page * SSD1306_WIDTH];
+        const uint8_t value = (*byte & ~mask) | (bits & mask);
+        if (value != *byte) {
+            *byte = value;
+            ssd1306_MarkColumns(x, x, page);
+        }
     }
 }
 
@@ -233,6 +752,27 @@ char ssd1306_WriteChar(char ch, SSD1306_Font_t Font, SSD1306_COLOR color) {
         return 0;
     }
 
+    if (Font.pages != NULL) {
+        // Write whole glyph bytes, shifted to the cursor's row: a glyph page covers
+        // at most two pages of the screenbuffer
+        const uint8_t glyphPages = (Font.height + 7) / 8;
+        const uint8_t* glyph = &Font.pages[(ch - 32) * Font.width * glyphPages];
+        const uint8_t shift = SSD1306.CurrentY % 8;
+        for(i = 0; i < glyphPages; i++) {
+            const uint8_t rows = Font.height - i * 8;
+            const uint16_t mask = (uint16_t) ((rows >= 8) ? 0xFF : (0xFF >> (8 - rows))) << shift;
+            for(j = 0; j < Font.width; j++) {
+                uint16_t bits = (uint16_t) glyph[i * Font.width + j] << shift;
+                if (color == Black) {
+                    bits = ~bits;
+                }
+                ssd1306_BlitColumn(SSD1306.CurrentX + j, SSD1306.CurrentY / 8 + i, mask, bits);
+            }
+        }
+        SSD1306.CurrentX += Font.char_width ? Font.char_width[ch - 32] : Font.width;
+        return ch;
+    }
+
     // Use the font to write
     for(i = 0; i < Font.height; i++) {
         b = Font.data[(ch - 32) * Font.height + i];
@@ -274,6 +814,19 @@ void ssd1306_SetCursor(uint8_t x, uint8_t y) {
 
 /* Draw line by Bresenhem's algorithm */
 void ssd1306_Line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
+    // Horizontal and vertical lines are filled a byte at a time, clipped like ssd1306_DrawPixel()
+    if (x1 == x2 || y1 == y2) {
+        uint8_t x_start = ((x1<=x2) ? x1 : x2);
+        uint8_t x_end   = ((x1<=x2) ? x2 : x1);
+        uint8_t y_start = ((y1<=y2) ? y1 : y2);
+        uint8_t y_end   = ((y1<=y2) ? y2 : y1);
+        if (x_start < SSD1306_WIDTH && y_start < SSD1306_HEIGHT) {
+            ssd1306_FillArea(x_start, y_start, (x_end < SSD1306_WIDTH) ? x_end : SSD1306_WIDTH - 1,
+                             (y_end < SSD1306_HEIGHT) ? y_end : SSD1306_HEIGHT - 1, color);
+        }
+        return;
+    }
+
     int32_t deltaX = abs(x2 - x1);
     int32_t deltaY = abs(y2 - y1);
     int32_t signX = ((x1 < x2) ? 1 : -1);
@@ -505,11 +1058,11 @@ void ssd1306_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD13
     uint8_t y_start = ((y1<=y2) ? y1 : y2);
     uint8_t y_end   = ((y1<=y2) ? y2 : y1);
 
-    for (uint8_t y= y_start; (y<= y_end)&&(y<SSD1306_HEIGHT); y++) {
-        for (uint8_t x= x_start; (x<= x_end)&&(x<SSD1306_WIDTH); x++) {
-            ssd1306_DrawPixel(x, y, color);
-        }
+    if (x_start >= SSD1306_WIDTH || y_start >= SSD1306_HEIGHT) {
+        return;
     }
+    ssd1306_FillArea(x_start, y_start, (x_end < SSD1306_WIDTH) ? x_end : SSD1306_WIDTH - 1,
+                     (y_end < SSD1306_HEIGHT) ? y_end : SSD1306_HEIGHT - 1, color);
     return;
 }
 
@@ -521,6 +1074,7 @@ SSD1306_Error_t ssd1306_InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint
     return SSD1306_ERR;
   }
   uint32_t i;
+  ssd1306_MarkArea(x1, y1, x2, y2);
   if ((y1 / 8) != (y2 / 8)) {
     /* if rectangle doesn't lie on one 8px row */
     for (uint32_t x = x1; x <= x2; x++) {
@@ -570,8 +1124,8 @@ void ssd1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8
 
 void ssd1306_SetContrast(const uint8_t value) {
     const uint8_t kSetContrastControlRegister = 0x81;
-    ssd1306_WriteCommand(kSetContrastControlRegister);
-    ssd1306_WriteCommand(value);
+    const uint8_t cmds[2] = { kSetContrastControlRegister, value };
+    ssd1306_WriteCommands(cmds, sizeof(cmds));
 }
 
 void ssd1306_SetDisplayOn(const uint8_t on) {
@@ -589,3 +1143,19 @@ void ssd1306_SetDisplayOn(const uint8_t on) {
 uint8_t ssd1306_GetDisplayOn() {
     return SSD1306.DisplayOn;
 }
+
+void ssd1306_SetInvert(const uint8_t on) {
+    uint8_t value;
+    if (on) {
+        value = 0xA7;   // Inverse color
+        SSD1306.Inverted = 1;
+    } else {
+        value = 0xA6;   // Normal color
+        SSD1306.Inverted = 0;
+    }
+    ssd1306_WriteCommand(value);
+}
+
+uint8_t ssd1306_GetInvert() {
+    return SSD1306.Inverted;
+}
@@ -894,22 +894,31 @@ static const uint8_t char_width[] = {
 };
 #endif
 
+/* Glyphs in page format, generated into ssd1306_page_fonts.c by Tools/genPageFonts.c. The
+ * generator itself is built with SSD1306_ROW_FONTS_ONLY, so it reads the row tables above
+ * without linking the file it writes. */
+#ifdef SSD1306_ROW_FONTS_ONLY
+#define SSD1306_PAGE_FONT(table) NULL
+#else
+#define SSD1306_PAGE_FONT(table) (table)
+#endif
+
 #ifdef SSD1306_INCLUDE_FONT_6x8
-const SSD1306_Font_t Font_6x8 = {6, 8, Font6x8, NULL};
+const SSD1306_Font_t Font_6x8 = {6, 8, Font6x8, NULL, SSD1306_PAGE_FONT(Font6x8Pages)};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_7x10
-const SSD1306_Font_t Font_7x10 = {7, 10, Font7x10, NULL};
+const SSD1306_Font_t Font_7x10 = {7, 10, Font7x10, NULL, SSD1306_PAGE_FONT(Font7x10Pages)};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_11x18
-const SSD1306_Font_t Font_11x18 = {11, 18, Font11x18, NULL};
+const SSD1306_Font_t Font_11x18 = {11, 18, Font11x18, NULL, NULL};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x26
-const SSD1306_Font_t Font_16x26 = {16, 26, Font16x26, NULL};
+const SSD1306_Font_t Font_16x26 = {16, 26, Font16x26, NULL, NULL};
 #endif
 
 /* see ./examples/custom-fonts/ */
 #ifdef SSD1306_INCLUDE_FONT_16x24
-const SSD1306_Font_t Font_16x24 = {16, 24, Font16x24, NULL};
+const SSD1306_Font_t Font_16x24 = {16, 24, Font16x24, NULL, NULL};
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_16x15
@@ -917,5 +926,5 @@ const SSD1306_Font_t Font_16x24 = {16, 24, Font16x24, NULL};
  * @copyright Google https://github.com/googlefonts/roboto
  * @license This font is licensed under the Apache License, Version 2.0.
 */
-const SSD1306_Font_t Font_16x15 = {16, 15, Font16x15, char_width};
+const SSD1306_Font_t Font_16x15 = {16, 15, Font16x15, char_width, NULL};
 #endif
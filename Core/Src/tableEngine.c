@@ -0,0 +1,67 @@
+/**
+ * @file tableEngine.c
+ * @brief Contains the 3x3 table engine.
+ *
+ * On 3x3 the whole game fits into a table: 'moveTable3x3' holds the perfect move of every position,
+ * so the engine answers with a single table read instead of searching the full game tree.
+ * The table is generated by 'Tools/genMoveTable.c'.
+ */
+#include <stdint.h>
+#include "engine.h"
+
+#define noTableMove 0xFF /**< Table entry of a position without a move */
+
+/**
+ * @brief Best move of every 3x3 position with the computer to move, as cell index row * 3 + column.
+ *
+ * Indexed by the base-3 encoding of the position: cell k contributes 3^k times 0 (empty),
+ * 1 (computer) or 2 (player). Defined in the generated 'moveTable3x3.c'.
+ */
+extern const uint8_t moveTable3x3[19683];
+
+/**
+ * @brief Looks up the computer's move on a 3x3 board.
+ *
+ * @param board The current game board, with the computer to move.
+ * @param size The size of the game board; only 3 is supported.
+ * @param budget Ignored, the lookup takes constant time.
+ * @param row Receives the row of the move.
+ * @param column Receives the column of the move.
+ * @return True if a move was found, false if the game is over or the size is not 3.
+ */
+static bool TableSearch(char board[maxFieldSize][maxFieldSize], int size, const EngineBudget *budget, int *row,
+		int *column) {
+	(void) budget;
+	if (size != 3)
+		return false;
+
+	int index = 0;
+	for (int cell = 8; cell >= 0; cell--) {
+		char piece = board[cell / 3][cell % 3];
+		index = index * 3 + (piece == secondPlayerChar) + 2 * (piece == firstPlayerChar);
+	}
+
+	uint8_t move = moveTable3x3[index];
+	if (move == noTableMove)
+		return false;
+	*row = move / 3;
+	*column = move % 3;
+	return true;
+}
+
+/**
+ * @brief Writes the statistics of the last move, which are always zero for a table lookup.
+ *
+ * @param stats Receives the statistics.
+ */
+static void TableStats(EngineStats *stats) {
+	stats->nodes = 0;
+	stats->depth = 0;
+}
+
+const Engine tableEngine = {
+	.name = "table",
+	.sizes = engineSize(3),
+	.search = TableSearch,
+	.stats = TableStats,
+};
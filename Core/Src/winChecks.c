@@ -8,10 +8,37 @@
  *
  * The functions are used to evaluate the current state of the board after each move and determine if the game 
  * should continue, has been won, or is a draw.
+ *
+ * 'checkWin()' is called for every node of the searches, so it does not walk the board cell by cell:
+ * it compares four cells of the board at once to build one bit mask per player, and finds the lines
+ * with a few shifts of those masks. On the Cortex-M4 the byte compares use the SIMD instructions,
+ * elsewhere a portable packed-byte (SWAR) compare. The cell-by-cell checks are kept in
+ * 'checkWinScalar()' as the reference for 'Tools/winCheckBench.c'.
  */
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 #include "winChecks.h"
 
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP == 1
+#include "cmsis_compiler.h"
+#endif
+
+#if maxFieldSize * maxFieldSize > 32
+#error "The board masks need one bit per cell in 32 bits"
+#endif
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "'cellBits()' expects the first cell of a word in its lowest byte"
+#endif
+
+#define boardCells (maxFieldSize * maxFieldSize) /**< Number of cells of the board array */
+#define allCells ((uint32_t) ((1ull << boardCells) - 1)) /**< Mask of all cells of the board array */
+#define firstColumn (allCells / ((1u << maxFieldSize) - 1)) /**< Mask of the cells in column 0 */
+#define columnsBelow(n) (firstColumn * ((1u << (n)) - 1)) /**< Mask of the cells in the first n columns */
+#define rowsBelow(n) ((uint32_t) ((1ull << ((n) * maxFieldSize)) - 1)) /**< Mask of the cells in the first n rows */
+#define repeatByte(c) ((uint8_t) (c) * 0x01010101u) /**< Word with the character in all four bytes */
+
 /**
  * @brief Checks if there is a winning condition horizontally.
  * 
@@ -187,17 +214,15 @@ bool isDraw(char field[maxFieldSize][maxFieldSize], int fieldSize) {
 }
 
 /**
- * @brief Checks if there is a winner or if the game has ended in a draw.
+ * @brief Checks if there is a winner or if the game has ended in a draw, cell by cell.
  *
- * This function checks for horizontal, vertical, and diagonal wins, as well as a draw condition. 
- * It returns the winner's character ('X' or 'O') or 'd' for a draw. If there is no winner and no draw, 
- * it returns '\0'.
+ * This function runs the horizontal, vertical, diagonal and draw checks above one after another.
  *
  * @param field The current game field.
  * @param fieldSize The size of the game field (3x3, 4x4, etc.).
  * @return The character of the winner ('X' or 'O'). Returns 'd' for a draw or '\0' if no result.
  */
-char checkWin(char field[maxFieldSize][maxFieldSize], int fieldSize) {
+char checkWinScalar(char field[maxFieldSize][maxFieldSize], int fieldSize) {
 	char toCheck[2] = { firstPlayerChar, secondPlayerChar };
 	int toWin = fieldSize > 3 ? fieldSize - 1 : 3;
 	for (int i = 0; i < 2; i++) {
@@ -214,3 +239,115 @@ char checkWin(char field[maxFieldSize][maxFieldSize], int fieldSize) {
 
 	return '\0';
 }
+
+/**
+ * @brief Compares the four characters of a word with a character.
+ *
+ * @param cells Four cells of the board, the first one in the lowest byte.
+ * @param pattern The character to compare with, repeated in all four bytes.
+ * @return 0x80 in every byte of a cell that holds the character, 0x00 in the others.
+ */
+static inline uint32_t matchCells(uint32_t cells, uint32_t pattern) {
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP == 1
+	/* USUB8 sets a byte's GE flag if cells >= pattern there, SEL then picks per flag: equal in both directions. */
+	__USUB8(cells, pattern);
+	uint32_t notBelow = __SEL(0x80808080u, 0);
+	__USUB8(pattern, cells);
+	return notBelow & __SEL(0x80808080u, 0);
+#else
+	/* Exact zero-byte test of the difference, without carries between the bytes. */
+	uint32_t difference = cells ^ pattern;
+	return ~(((difference & 0x7F7F7F7Fu) + 0x7F7F7F7Fu) | difference | 0x7F7F7F7Fu);
+#endif
+}
+
+/**
+ * @brief Packs the byte flags of 'matchCells()' into four consecutive bits.
+ *
+ * The multiplication moves the flag of byte k to bit 21 + k; no two partial products overlap.
+ *
+ * @param flags 0x80 or 0x00 in every byte.
+ * @return The flags of the bytes 0 to 3 in the bits 0 to 3.
+ */
+static inline uint32_t packCells(uint32_t flags) {
+	return (((flags >> 7) * 0x00204081u) >> 21) & 0xFu;
+}
+
+/**
+ * @brief Builds the masks of the cells of both players, bit row * maxFieldSize + column for each cell.
+ *
+ * @param field The current game field.
+ * @param first Receives the mask of the first player's cells.
+ * @param second Receives the mask of the second player's cells.
+ */
+static inline void cellBits(char field[maxFieldSize][maxFieldSize], uint32_t *first, uint32_t *second) {
+	const char *cells = &field[0][0];
+	uint32_t firstBits = 0, secondBits = 0;
+	int cell = 0;
+	for (; cell + 4 <= boardCells; cell += 4) {
+		uint32_t word;
+		memcpy(&word, cells + cell, sizeof(word));
+		firstBits |= packCells(matchCells(word, repeatByte(firstPlayerChar))) << cell;
+		secondBits |= packCells(matchCells(word, repeatByte(secondPlayerChar))) << cell;
+	}
+	for (; cell < boardCells; cell++) {
+		firstBits |= (uint32_t) (cells[cell] == firstPlayerChar) << cell;
+		secondBits |= (uint32_t) (cells[cell] == secondPlayerChar) << cell;
+	}
+	*first = firstBits;
+	*second = secondBits;
+}
+
+/**
+ * @brief Checks if a mask of cells contains 'toWin' consecutive cells in a row, column or diagonal.
+ *
+ * After the shifts, a bit is left for every cell that starts a line to the right, down, down-right or
+ * down-left. Lines that would wrap from the last column into the next row are masked out; lines that
+ * leave the board at the bottom shift in zeros.
+ *
+ * @param bits The mask of one player's cells.
+ * @param toWin The number of consecutive marks required for a win.
+ * @return True if there is a winning line, false otherwise.
+ */
+static inline bool hasLine(uint32_t bits, int toWin) {
+	uint32_t right = bits, down = bits, downRight = bits, downLeft = bits;
+	for (int i = 1; i < toWin; i++) {
+		right &= bits >> i;
+		down &= bits >> (i * maxFieldSize);
+		downRight &= bits >> (i * (maxFieldSize + 1));
+		downLeft &= bits >> (i * (maxFieldSize - 1));
+	}
+	uint32_t fitsRight = columnsBelow(maxFieldSize - toWin + 1);
+	uint32_t fitsLeft = allCells & ~columnsBelow(toWin - 1);
+
+	return ((right | downRight) & fitsRight) | down | (downLeft & fitsLeft);
+}
+
+/**
+ * @brief Checks if there is a winner or if the game has ended in a draw.
+ *
+ * This function checks for horizontal, vertical, and diagonal wins, as well as a draw condition. 
+ * It returns the winner's character ('X' or 'O') or 'd' for a draw. If there is no winner and no draw, 
+ * it returns '\0'. The result is the same as that of 'checkWinScalar()'.
+ *
+ * @param field The current game field.
+ * @param fieldSize The size of the game field (3x3, 4x4, etc.).
+ * @return The character of the winner ('X' or 'O'). Returns 'd' for a draw or '\0' if no result.
+ */
+char checkWin(char field[maxFieldSize][maxFieldSize], int fieldSize) {
+	int toWin = fieldSize > 3 ? fieldSize - 1 : 3;
+	uint32_t onBoard = columnsBelow(fieldSize) & rowsBelow(fieldSize);
+	uint32_t first, second;
+	cellBits(field, &first, &second);
+	first &= onBoard;
+	second &= onBoard;
+
+	if (hasLine(first, toWin))
+		return firstPlayerChar;
+	if (hasLine(second, toWin))
+		return secondPlayerChar;
+	if ((first | second) == onBoard)
+		return 'd';
+
+	return '\0';
+}
@@ -0,0 +1,259 @@
+/**
+ * @file batchEval.c
+ * @brief Contains the host-side batch evaluation of many positions per call.
+ *
+ * Every window of the evaluation tables is turned into its base-3 index for a whole vector of positions
+ * at once: the digit of a cell is one bit of the computer's bitboard plus twice the bit of the player's.
+ * The score is a table read of that index, gathered with AVX2 or read lane by lane with SSE2, and a
+ * window whose index has all digits 1 or all digits 2 is a won line, so the win status falls out of the
+ * same loop.
+ */
+#include <stdlib.h>
+#include "batchEval.h"
+#include "evaluation.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Score tables of every board size widened to 32 bits, as the AVX2 gather reads 32-bit elements.
+ */
+static int32_t wideScores[maxFieldSize - 2][81];
+
+/**
+ * @brief Tables that apply to one batch.
+ */
+typedef struct {
+	const EvalMode *mode;
+	const int32_t *scores; /**< The score table of the board size, widened to 32 bits */
+	uint32_t computerLine; /**< Window index with a computer piece in every cell */
+	uint32_t playerLine; /**< Window index with a player piece in every cell */
+	uint32_t onBoard; /**< Mask of the cells of the board */
+} BatchTables;
+
+bool BatchInit(BatchBoards *batch, int size, size_t capacity) {
+	batch->size = size;
+	batch->count = 0;
+	batch->capacity = capacity;
+	batch->computer = malloc(capacity * sizeof(*batch->computer));
+	batch->player = malloc(capacity * sizeof(*batch->player));
+	batch->status = malloc(capacity * sizeof(*batch->status));
+	batch->scores = malloc(capacity * sizeof(*batch->scores));
+	if (batch->computer == NULL || batch->player == NULL || batch->status == NULL || batch->scores == NULL) {
+		BatchRelease(batch);
+		return false;
+	}
+	return true;
+}
+
+void BatchRelease(BatchBoards *batch) {
+	free(batch->computer);
+	free(batch->player);
+	free(batch->status);
+	free(batch->scores);
+	batch->computer = batch->player = NULL;
+	batch->status = NULL;
+	batch->scores = NULL;
+	batch->count = batch->capacity = 0;
+}
+
+void BatchAdd(BatchBoards *batch, char board[maxFieldSize][maxFieldSize]) {
+	uint32_t computer = 0, player = 0;
+	for (int i = 0; i < batch->size; i++) {
+		for (int j = 0; j < batch->size; j++) {
+			computer |= (uint32_t) (board[i][j] == secondPlayerChar) << (i * maxFieldSize + j);
+			player |= (uint32_t) (board[i][j] == firstPlayerChar) << (i * maxFieldSize + j);
+		}
+	}
+	batch->computer[batch->count] = computer;
+	batch->player[batch->count] = player;
+	batch->count++;
+}
+
+/**
+ * @brief Prepares the tables of a board size.
+ *
+ * @param size The size of the game boards.
+ * @param tables Receives the tables.
+ */
+static void prepareTables(int size, BatchTables *tables) {
+	const EvalMode *mode = &evalModes[size - 3];
+	int32_t *scores = wideScores[size - 3];
+	int indexCount = 1;
+	uint32_t line = 0;
+	for (int k = 0; k < mode->toWin; k++) {
+		line = line * 3 + 1;
+		indexCount *= 3;
+	}
+	for (int index = 0; index < indexCount; index++)
+		scores[index] = mode->scores[index];
+
+	tables->mode = mode;
+	tables->scores = scores;
+	tables->computerLine = line;
+	tables->playerLine = 2 * line;
+	tables->onBoard = 0;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++)
+			tables->onBoard |= 1u << (i * maxFieldSize + j);
+	}
+}
+
+/**
+ * @brief Turns the line flags and the occupied cells of a position into its 'checkWin()' result.
+ *
+ * @param playerWins True if the player has a complete line.
+ * @param computerWins True if the computer has a complete line.
+ * @param isFull True if every cell of the board is occupied.
+ * @return The win status.
+ */
+static inline char statusOf(bool playerWins, bool computerWins, bool isFull) {
+	if (playerWins)
+		return firstPlayerChar;
+	if (computerWins)
+		return secondPlayerChar;
+	return isFull ? 'd' : '\0';
+}
+
+/**
+ * @brief Evaluates a single position of a batch.
+ *
+ * @param batch The batch.
+ * @param tables The tables of the board size.
+ * @param p The index of the position.
+ */
+static void evaluateOne(BatchBoards *batch, const BatchTables *tables, size_t p) {
+	const EvalMode *mode = tables->mode;
+	const uint8_t *window = mode->windowCells;
+	uint32_t computer = batch->computer[p], player = batch->player[p];
+	int32_t score = 0;
+	bool computerWins = false, playerWins = false;
+
+	for (int w = 0; w < mode->windowCount; w++, window += mode->toWin) {
+		uint32_t index = 0;
+		for (int k = mode->toWin - 1; k >= 0; k--)
+			index = index * 3 + ((computer >> window[k]) & 1) + 2 * ((player >> window[k]) & 1);
+		score += tables->scores[index];
+		computerWins |= index == tables->computerLine;
+		playerWins |= index == tables->playerLine;
+	}
+
+	batch->scores[p] = score;
+	batch->status[p] = statusOf(playerWins, computerWins, (computer | player) == tables->onBoard);
+}
+
+#if defined(__AVX2__)
+/**
+ * @brief Evaluates eight positions of a batch with AVX2.
+ *
+ * @param batch The batch.
+ * @param tables The tables of the board size.
+ * @param p The index of the first position.
+ */
+static void evaluateVector(BatchBoards *batch, const BatchTables *tables, size_t p) {
+	const EvalMode *mode = tables->mode;
+	const uint8_t *window = mode->windowCells;
+	__m256i computer = _mm256_loadu_si256((const __m256i*) &batch->computer[p]);
+	__m256i player = _mm256_loadu_si256((const __m256i*) &batch->player[p]);
+	__m256i one = _mm256_set1_epi32(1), score = _mm256_setzero_si256();
+	__m256i computerWins = _mm256_setzero_si256(), playerWins = _mm256_setzero_si256();
+	__m256i computerLine = _mm256_set1_epi32(tables->computerLine);
+	__m256i playerLine = _mm256_set1_epi32(tables->playerLine);
+
+	for (int w = 0; w < mode->windowCount; w++, window += mode->toWin) {
+		__m256i index = _mm256_setzero_si256();
+		for (int k = mode->toWin - 1; k >= 0; k--) {
+			__m128i shift = _mm_cvtsi32_si128(window[k]);
+			__m256i computerBit = _mm256_and_si256(_mm256_srl_epi32(computer, shift), one);
+			__m256i playerBit = _mm256_and_si256(_mm256_srl_epi32(player, shift), one);
+			__m256i digit = _mm256_add_epi32(computerBit, _mm256_add_epi32(playerBit, playerBit));
+			index = _mm256_add_epi32(_mm256_add_epi32(index, _mm256_add_epi32(index, index)), digit);
+		}
+		score = _mm256_add_epi32(score, _mm256_i32gather_epi32((const int*) tables->scores, index, 4));
+		computerWins = _mm256_or_si256(computerWins, _mm256_cmpeq_epi32(index, computerLine));
+		playerWins = _mm256_or_si256(playerWins, _mm256_cmpeq_epi32(index, playerLine));
+	}
+
+	__m256i full = _mm256_cmpeq_epi32(_mm256_or_si256(computer, player), _mm256_set1_epi32(tables->onBoard));
+	int computerMask = _mm256_movemask_ps(_mm256_castsi256_ps(computerWins));
+	int playerMask = _mm256_movemask_ps(_mm256_castsi256_ps(playerWins));
+	int fullMask = _mm256_movemask_ps(_mm256_castsi256_ps(full));
+	_mm256_storeu_si256((__m256i*) &batch->scores[p], score);
+	for (int lane = 0; lane < 8; lane++)
+		batch->status[p + lane] = statusOf(playerMask >> lane & 1, computerMask >> lane & 1, fullMask >> lane & 1);
+}
+
+#define vectorLanes 8 /**< Positions per call of 'evaluateVector()' */
+#define backendName "avx2" /**< Name of the backend */
+#elif defined(__SSE2__)
+/**
+ * @brief Evaluates four positions of a batch with SSE2.
+ *
+ * SSE2 has no gather, so the window indices are computed in the vector and the scores read lane by lane.
+ *
+ * @param batch The batch.
+ * @param tables The tables of the board size.
+ * @param p The index of the first position.
+ */
+static void evaluateVector(BatchBoards *batch, const BatchTables *tables, size_t p) {
+	const EvalMode *mode = tables->mode;
+	const uint8_t *window = mode->windowCells;
+	__m128i computer = _mm_loadu_si128((const __m128i*) &batch->computer[p]);
+	__m128i player = _mm_loadu_si128((const __m128i*) &batch->player[p]);
+	__m128i one = _mm_set1_epi32(1);
+	__m128i computerWins = _mm_setzero_si128(), playerWins = _mm_setzero_si128();
+	__m128i computerLine = _mm_set1_epi32(tables->computerLine);
+	__m128i playerLine = _mm_set1_epi32(tables->playerLine);
+	int32_t score[4] = { 0 };
+	uint32_t indices[4];
+
+	for (int w = 0; w < mode->windowCount; w++, window += mode->toWin) {
+		__m128i index = _mm_setzero_si128();
+		for (int k = mode->toWin - 1; k >= 0; k--) {
+			__m128i shift = _mm_cvtsi32_si128(window[k]);
+			__m128i computerBit = _mm_and_si128(_mm_srl_epi32(computer, shift), one);
+			__m128i playerBit = _mm_and_si128(_mm_srl_epi32(player, shift), one);
+			__m128i digit = _mm_add_epi32(computerBit, _mm_add_epi32(playerBit, playerBit));
+			index = _mm_add_epi32(_mm_add_epi32(index, _mm_add_epi32(index, index)), digit);
+		}
+		_mm_storeu_si128((__m128i*) indices, index);
+		for (int lane = 0; lane < 4; lane++)
+			score[lane] += tables->scores[indices[lane]];
+		computerWins = _mm_or_si128(computerWins, _mm_cmpeq_epi32(index, computerLine));
+		playerWins = _mm_or_si128(playerWins, _mm_cmpeq_epi32(index, playerLine));
+	}
+
+	__m128i full = _mm_cmpeq_epi32(_mm_or_si128(computer, player), _mm_set1_epi32(tables->onBoard));
+	int computerMask = _mm_movemask_ps(_mm_castsi128_ps(computerWins));
+	int playerMask = _mm_movemask_ps(_mm_castsi128_ps(playerWins));
+	int fullMask = _mm_movemask_ps(_mm_castsi128_ps(full));
+	for (int lane = 0; lane < 4; lane++) {
+		batch->scores[p + lane] = score[lane];
+		batch->status[p + lane] = statusOf(playerMask >> lane & 1, computerMask >> lane & 1, fullMask >> lane & 1);
+	}
+}
+
+#define vectorLanes 4 /**< Positions per call of 'evaluateVector()' */
+#define backendName "sse2" /**< Name of the backend */
+#else
+#define vectorLanes 0 /**< No vector backend */
+#define backendName "scalar" /**< Name of the backend */
+#endif
+
+void BatchEvaluate(BatchBoards *batch) {
+	BatchTables tables;
+	prepareTables(batch->size, &tables);
+
+	size_t p = 0;
+#if vectorLanes > 0
+	for (; p + vectorLanes <= batch->count; p += vectorLanes)
+		evaluateVector(batch, &tables, p);
+#endif
+	for (; p < batch->count; p++)
+		evaluateOne(batch, &tables, p);
+}
+
+const char* BatchBackend(void) {
+	return backendName;
+}
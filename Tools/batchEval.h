@@ -0,0 +1,76 @@
+/**
+ * @file batchEval.h
+ * @brief Host-side batch evaluation of many positions per call, for the offline tools.
+ *
+ * Tools that evaluate millions of boards (self-play, tuning, table generation) store their positions as
+ * a struct of arrays of bitboards, one bit per cell (row * maxFieldSize + column) and player, and get
+ * the win status and the static evaluation of all of them in one call. The results are the same as
+ * those of 'checkWin()' and 'EvaluateBoard()'. The evaluation runs eight positions at a time with AVX2,
+ * four with SSE2, and one at a time otherwise; build with -march=native to enable AVX2.
+ *
+ * Add 'Tools/batchEval.c', 'Core/Src/evaluation.c' and 'Core/Src/evalTables.c' to the build of a tool.
+ */
+#pragma once
+#ifndef TOOLS_BATCHEVAL_H_
+#define TOOLS_BATCHEVAL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "gameConfiguration.h"
+
+/**
+ * @brief A batch of positions of one board size and their results.
+ */
+typedef struct {
+	int size; /**< The size of all game boards of the batch */
+	size_t count; /**< The number of positions */
+	size_t capacity; /**< The number of positions the arrays can hold */
+	uint32_t *computer; /**< Bitboards of the computer's pieces ('o') */
+	uint32_t *player; /**< Bitboards of the player's pieces ('x') */
+	char *status; /**< Results as returned by 'checkWin()' */
+	int32_t *scores; /**< Results as returned by 'EvaluateBoard()' */
+} BatchBoards;
+
+/**
+ * @brief Allocates an empty batch.
+ *
+ * @param batch The batch.
+ * @param size The size of the game boards.
+ * @param capacity The largest number of positions.
+ * @return True on success, false if the memory cannot be allocated.
+ */
+bool BatchInit(BatchBoards *batch, int size, size_t capacity);
+
+/**
+ * @brief Frees the arrays of a batch.
+ *
+ * @param batch The batch.
+ */
+void BatchRelease(BatchBoards *batch);
+
+/**
+ * @brief Appends a position to a batch.
+ *
+ * @param batch The batch, which must not be full.
+ * @param board The game board.
+ */
+void BatchAdd(BatchBoards *batch, char board[maxFieldSize][maxFieldSize]);
+
+/**
+ * @brief Computes the win status and the static evaluation of every position of a batch.
+ *
+ * The evaluation is computed for every position, but is only meaningful where the status is '\0'.
+ *
+ * @param batch The batch; fills 'status' and 'scores'.
+ */
+void BatchEvaluate(BatchBoards *batch);
+
+/**
+ * @brief Returns the name of the instruction set used by 'BatchEvaluate()'.
+ *
+ * @return "avx2", "sse2" or "scalar".
+ */
+const char* BatchBackend(void);
+
+#endif /* TOOLS_BATCHEVAL_H_ */
@@ -0,0 +1,108 @@
+/**
+ * @file batchEvalBench.c
+ * @brief Host benchmark of the batch evaluation against one 'checkWin()' and 'EvaluateBoard()' call per board.
+ *
+ * For every board size, the benchmark fills a batch with random positions, from empty to full boards,
+ * verifies that 'BatchEvaluate()' returns the same status and evaluation as the single-board functions,
+ * and reports the positions per second of both.
+ *
+ * Build (from the repository root), with -march=native for the AVX2 backend:
+ *   gcc -O2 -march=native -ICore/Inc -ITools Tools/batchEvalBench.c Tools/batchEval.c Core/Src/evaluation.c \
+ *       Core/Src/evalTables.c Core/Src/winChecks.c -o batchEvalBench
+ *
+ * Usage:
+ *   ./batchEvalBench [positions] [rounds]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gameConfiguration.h"
+#include "batchEval.h"
+#include "evaluation.h"
+#include "winChecks.h"
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Fills a board with random pieces of both players, alternating like in a game.
+ *
+ * @param board Receives the position.
+ * @param size The size of the game board.
+ */
+static void randomBoard(char board[maxFieldSize][maxFieldSize], int size) {
+	memset(board, 0, maxFieldSize * maxFieldSize);
+	int pieces = rand() % (size * size + 1);
+	for (int k = 0; k < pieces;) {
+		int cell = rand() % (size * size);
+		if (board[cell / size][cell % size] != '\0')
+			continue;
+		board[cell / size][cell % size] = k % 2 ? secondPlayerChar : firstPlayerChar;
+		k++;
+	}
+}
+
+int main(int argc, char **argv) {
+	long count = argc > 1 ? atol(argv[1]) : 100000;
+	int rounds = argc > 2 ? atoi(argv[2]) : 20;
+	if (count < 1 || rounds < 1) {
+		fprintf(stderr, "usage: %s [positions] [rounds]\n", argv[0]);
+		return 2;
+	}
+
+	char (*boards)[maxFieldSize][maxFieldSize] = malloc(count * sizeof(*boards));
+	if (boards == NULL)
+		return 2;
+
+	srand(1);
+	printf("backend %s\n%-4s %14s %14s %8s\n", BatchBackend(), "size", "single pos/s", "batch pos/s", "speedup");
+	for (int size = 3; size <= maxFieldSize; size++) {
+		BatchBoards batch;
+		if (!BatchInit(&batch, size, count))
+			return 2;
+		for (long p = 0; p < count; p++) {
+			randomBoard(boards[p], size);
+			BatchAdd(&batch, boards[p]);
+		}
+
+		BatchEvaluate(&batch);
+		for (long p = 0; p < count; p++) {
+			char status = checkWin(boards[p], size);
+			int score = EvaluateBoard(boards[p], size);
+			if (batch.status[p] != status || (status == '\0' && batch.scores[p] != score)) {
+				fprintf(stderr, "%dx%d position %ld: batch '%c' %d, single '%c' %d\n", size, size, p,
+						batch.status[p] ? batch.status[p] : '-', batch.scores[p], status ? status : '-', score);
+				return 1;
+			}
+		}
+
+		volatile long sink = 0;
+		double start = now();
+		for (int r = 0; r < rounds; r++) {
+			for (long p = 0; p < count; p++)
+				sink += checkWin(boards[p], size) + EvaluateBoard(boards[p], size);
+		}
+		double single = now() - start;
+
+		start = now();
+		for (int r = 0; r < rounds; r++) {
+			BatchEvaluate(&batch);
+			sink += batch.scores[r % count];
+		}
+		double batched = now() - start;
+
+		double positions = (double) count * rounds;
+		printf("%dx%d  %14.0f %14.0f %7.2fx\n", size, size, positions / single, positions / batched, single / batched);
+		BatchRelease(&batch);
+	}
+
+	free(boards);
+	return 0;
+}
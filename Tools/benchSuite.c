@@ -0,0 +1,175 @@
+/**
+ * @file benchSuite.c
+ * @brief Host driver of the engine throughput benchmark suite in 'Core/Src/benchmark.c'.
+ *
+ * The tool runs the suite and writes its JSON output to stdout or a file. Given the output of an earlier
+ * run as a baseline, it also gates regressions: it compares every result with the baseline result of
+ * the same name and fails if the time per operation or the number of search nodes grew by more than
+ * the tolerance. Node counts do not depend on the machine; times only compare on the same machine.
+ * The firmware runs the same suite when built with ENGINE_BENCHMARK defined and prints the JSON on the
+ * UART, timed in CPU cycles, so target results can be gated the same way. The default tolerance of 25%
+ * is above the run-to-run noise of the shortest host measurements.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/benchSuite.c Core/Src/benchmark.c Core/Src/engine.c Core/Src/tableEngine.c \
+ *       Core/Src/moveTable3x3.c Core/Src/minimax.c Core/Src/proofNumber.c Core/Src/evaluation.c \
+ *       Core/Src/evalTables.c Core/Src/winChecks.c -o benchSuite
+ *
+ * Usage:
+ *   ./benchSuite [-o output.json] [-b baseline.json] [-t tolerance%]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+
+#define outputCapacity 65536 /**< Largest supported size of the benchmark output in bytes */
+
+static char output[outputCapacity];
+static size_t outputLength;
+
+/**
+ * @brief Appends a piece of the benchmark output to the output buffer.
+ *
+ * @param text The piece of output.
+ */
+static void appendOutput(const char *text) {
+	size_t length = strlen(text);
+	if (outputLength + length >= outputCapacity) {
+		fprintf(stderr, "benchmark output exceeds %d bytes\n", outputCapacity);
+		exit(2);
+	}
+	memcpy(output + outputLength, text, length + 1);
+	outputLength += length;
+}
+
+/**
+ * @brief Reads a numeric field of a result line.
+ *
+ * @param line The result line.
+ * @param field The name of the field.
+ * @param value Receives the value.
+ * @return True if the line has the field, false otherwise.
+ */
+static bool readField(const char *line, const char *field, double *value) {
+	char key[64];
+	snprintf(key, sizeof(key), "\"%s\": ", field);
+	const char *found = strstr(line, key);
+	if (found == NULL)
+		return false;
+	*value = strtod(found + strlen(key), NULL);
+	return true;
+}
+
+/**
+ * @brief Reads the name of a result line.
+ *
+ * @param line The result line.
+ * @param name Receives the name.
+ * @param capacity The size of 'name'.
+ * @return True if the line is a result, false otherwise.
+ */
+static bool readName(const char *line, char *name, size_t capacity) {
+	const char *found = strstr(line, "{\"name\": \"");
+	if (found == NULL)
+		return false;
+	found += strlen("{\"name\": \"");
+	const char *end = strchr(found, '"');
+	if (end == NULL || (size_t) (end - found) >= capacity)
+		return false;
+	memcpy(name, found, end - found);
+	name[end - found] = '\0';
+	return true;
+}
+
+/**
+ * @brief Finds the result line with a name in the benchmark output.
+ *
+ * @param name The name of the result.
+ * @return The start of the line, or NULL if there is no such result.
+ */
+static const char* findResult(const char *name) {
+	char key[128];
+	snprintf(key, sizeof(key), "{\"name\": \"%s\"", name);
+	return strstr(output, key);
+}
+
+/**
+ * @brief Compares the benchmark output with a baseline and reports the regressions.
+ *
+ * @param baselinePath The path of the baseline output.
+ * @param tolerance The allowed growth of times and node counts in percent.
+ * @return The number of regressions, or -1 if the baseline cannot be read.
+ */
+static int compareBaseline(const char *baselinePath, double tolerance) {
+	FILE *baseline = fopen(baselinePath, "r");
+	if (baseline == NULL) {
+		perror(baselinePath);
+		return -1;
+	}
+
+	int regressions = 0;
+	char line[512], name[96];
+	while (fgets(line, sizeof(line), baseline) != NULL) {
+		if (!readName(line, name, sizeof(name)))
+			continue;
+		const char *current = findResult(name);
+		if (current == NULL) {
+			fprintf(stderr, "missing   %s\n", name);
+			regressions++;
+			continue;
+		}
+
+		static const char *const gated[] = { "nsPerOp", "nodes" };
+		for (int g = 0; g < 2; g++) {
+			double before, after;
+			if (!readField(line, gated[g], &before) || !readField(current, gated[g], &after))
+				continue;
+			double growth = before > 0 ? (after - before) * 100 / before : (after > 0 ? 100 : 0);
+			if (growth > tolerance) {
+				fprintf(stderr, "regressed %s: %s %.0f -> %.0f (%+.1f%%)\n", name, gated[g], before, after, growth);
+				regressions++;
+			}
+		}
+	}
+
+	fclose(baseline);
+	return regressions;
+}
+
+int main(int argc, char **argv) {
+	const char *outputPath = NULL, *baselinePath = NULL;
+	double tolerance = 25;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			outputPath = argv[++i];
+		} else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+			baselinePath = argv[++i];
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			tolerance = atof(argv[++i]);
+		} else {
+			fprintf(stderr, "usage: %s [-o output.json] [-b baseline.json] [-t tolerance%%]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	BenchmarkRun(appendOutput);
+
+	FILE *out = outputPath != NULL ? fopen(outputPath, "w") : stdout;
+	if (out == NULL) {
+		perror(outputPath);
+		return 2;
+	}
+	fputs(output, out);
+	if (out != stdout)
+		fclose(out);
+
+	if (baselinePath == NULL)
+		return 0;
+	int regressions = compareBaseline(baselinePath, tolerance);
+	if (regressions < 0)
+		return 2;
+	fprintf(stderr, "%d regressions beyond %.1f%%\n", regressions, tolerance);
+	return regressions > 0;
+}
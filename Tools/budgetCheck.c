@@ -0,0 +1,105 @@
+/**
+ * @file budgetCheck.c
+ * @brief Host tool checking that a node budget plays no weaker than the depth it can afford.
+ *
+ * For random undecided positions of every board size, the Minimax engine first searches to a fixed depth,
+ * then searches again with a node budget equal to the nodes that search reported. The budgeted search
+ * deepens iteratively and its proof-number check does not count against the budget, so it must complete
+ * at least the same depth, and, where it stops at that depth, choose the same move. The guarantee holds
+ * while the proof-number check costs more nodes than the shallower iterations, which is the case for the
+ * first two plies; deeper depths can be checked with '-d' to see how often it fails there.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/budgetCheck.c Core/Src/engine.c Core/Src/tableEngine.c Core/Src/moveTable3x3.c \
+ *       Core/Src/minimax.c Core/Src/proofNumber.c Core/Src/evaluation.c Core/Src/evalTables.c \
+ *       Core/Src/winChecks.c -lm -o budgetCheck
+ *
+ * Usage:
+ *   ./budgetCheck [-d depth] [-n positions]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "gameConfiguration.h"
+#include "engine.h"
+#include "winChecks.h"
+
+/**
+ * @brief Generates a random undecided position with the same number of pieces for both players.
+ *
+ * @param board Receives the position.
+ * @param size The size of the game board.
+ */
+static void randomPosition(char board[maxFieldSize][maxFieldSize], int size) {
+	do {
+		memset(board, 0, maxFieldSize * maxFieldSize);
+		int pieces = 2 * (rand() % (size * size / 2));
+		for (int k = 0; k < pieces;) {
+			int cell = rand() % (size * size);
+			if (board[cell / size][cell % size] != '\0')
+				continue;
+			board[cell / size][cell % size] = k % 2 ? secondPlayerChar : firstPlayerChar;
+			k++;
+		}
+	} while (checkWin(board, size) != '\0');
+}
+
+int main(int argc, char **argv) {
+	int maxDepth = 2, positionCount = 300, option;
+	while ((option = getopt(argc, argv, "d:n:")) != -1) {
+		switch (option) {
+		case 'd':
+			maxDepth = atoi(optarg);
+			break;
+		case 'n':
+			positionCount = atoi(optarg);
+			break;
+		default:
+			return 2;
+		}
+	}
+	if (optind != argc || maxDepth < 1 || positionCount < 1) {
+		fprintf(stderr, "usage: %s [-d depth] [-n positions]\n", argv[0]);
+		return 2;
+	}
+
+	const Engine *engine = EngineFind("minimax");
+	int failures = 0;
+	if (engine->init != NULL)
+		engine->init();
+	for (int size = 3; size <= maxFieldSize; size++) {
+		for (int depth = 1; depth <= maxDepth; depth++) {
+			srand(size * 100 + depth);
+			int weaker = 0;
+			unsigned long totalNodes = 0;
+			for (int p = 0; p < positionCount; p++) {
+				char board[maxFieldSize][maxFieldSize];
+				randomPosition(board, size);
+
+				EngineBudget depthBudget = { .maxDepth = depth };
+				EngineStats depthStats, nodeStats;
+				int row, column, nodeRow, nodeColumn;
+				engine->search(board, size, &depthBudget, &row, &column);
+				engine->stats(&depthStats);
+
+				EngineBudget nodeBudget = { .maxNodes = depthStats.nodes };
+				engine->search(board, size, &nodeBudget, &nodeRow, &nodeColumn);
+				engine->stats(&nodeStats);
+				totalNodes += depthStats.nodes;
+
+				if (nodeStats.depth < depthStats.depth
+						|| (nodeStats.depth == depthStats.depth && (nodeRow != row || nodeColumn != column)))
+					weaker++;
+			}
+			printf("%dx%d depth %d: %d positions, %lu nodes/move, %d weaker with the same nodes %s\n", size,
+					size, depth, positionCount, totalNodes / positionCount, weaker, weaker == 0 ? "ok" : "FAIL");
+			failures += weaker > 0;
+		}
+	}
+
+	if (failures > 0)
+		printf("%d checks failed\n", failures);
+	return failures > 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file dataset.h
+ * @brief Binary format of the labelled positions written by 'Tools/selfPlay.c' and read by 'Tools/texelTune.c'.
+ *
+ * A dataset is a header followed by 'count' records of 'datasetRecordSize' bytes. All numbers are
+ * little-endian. A record stores the board size, the result of the game the position occurred in,
+ * the ply of the position, and the bitboards of both players (bit row * maxFieldSize + column).
+ */
+#pragma once
+#ifndef TOOLS_DATASET_H_
+#define TOOLS_DATASET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define datasetMagic "XOD1" /**< First four bytes of a dataset */
+#define datasetHeaderSize 8 /**< Magic and record count */
+#define datasetRecordSize 11 /**< Size, result, ply and two 32-bit bitboards */
+
+/**
+ * @brief Results of the game a position occurred in.
+ */
+enum datasetResults {
+	playerWon, gameDrawn, computerWon,
+};
+
+/**
+ * @brief A labelled position.
+ */
+typedef struct {
+	uint8_t size; /**< The size of the game board */
+	uint8_t result; /**< One of 'datasetResults' */
+	uint8_t ply; /**< The number of pieces placed before the position, removals in custom mode not counted */
+	uint32_t computer; /**< Bitboard of the computer's pieces ('o') */
+	uint32_t player; /**< Bitboard of the player's pieces ('x') */
+} DatasetRecord;
+
+/**
+ * @brief Stores a 32-bit number in little-endian byte order.
+ */
+static inline void datasetPut32(uint8_t *bytes, uint32_t value) {
+	for (int i = 0; i < 4; i++)
+		bytes[i] = value >> (8 * i);
+}
+
+/**
+ * @brief Loads a 32-bit number in little-endian byte order.
+ */
+static inline uint32_t datasetGet32(const uint8_t *bytes) {
+	return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t) bytes[3] << 24;
+}
+
+/**
+ * @brief Encodes a record.
+ *
+ * @param record The record.
+ * @param bytes Receives 'datasetRecordSize' bytes.
+ */
+static inline void datasetEncode(const DatasetRecord *record, uint8_t bytes[datasetRecordSize]) {
+	bytes[0] = record->size;
+	bytes[1] = record->result;
+	bytes[2] = record->ply;
+	datasetPut32(bytes + 3, record->computer);
+	datasetPut32(bytes + 7, record->player);
+}
+
+/**
+ * @brief Decodes a record.
+ *
+ * @param bytes The 'datasetRecordSize' bytes of the record.
+ * @param record Receives the record.
+ */
+static inline void datasetDecode(const uint8_t bytes[datasetRecordSize], DatasetRecord *record) {
+	record->size = bytes[0];
+	record->result = bytes[1];
+	record->ply = bytes[2];
+	record->computer = datasetGet32(bytes + 3);
+	record->player = datasetGet32(bytes + 7);
+}
+
+/**
+ * @brief Writes a dataset header.
+ *
+ * @param file The dataset, positioned at its start.
+ * @param count The number of records.
+ * @return True on success.
+ */
+static inline bool datasetWriteHeader(FILE *file, uint32_t count) {
+	uint8_t header[datasetHeaderSize] = { datasetMagic[0], datasetMagic[1], datasetMagic[2], datasetMagic[3] };
+	datasetPut32(header + 4, count);
+	return fwrite(header, sizeof(header), 1, file) == 1;
+}
+
+/**
+ * @brief Reads and checks a dataset header.
+ *
+ * @param file The dataset, positioned at its start.
+ * @param count Receives the number of records.
+ * @return True if the file starts with a valid header.
+ */
+static inline bool datasetReadHeader(FILE *file, uint32_t *count) {
+	uint8_t header[datasetHeaderSize];
+	if (fread(header, sizeof(header), 1, file) != 1 || header[0] != datasetMagic[0] || header[1] != datasetMagic[1]
+			|| header[2] != datasetMagic[2] || header[3] != datasetMagic[3])
+		return false;
+	*count = datasetGet32(header + 4);
+	return true;
+}
+
+#endif /* TOOLS_DATASET_H_ */
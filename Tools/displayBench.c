@@ -0,0 +1,467 @@
+/**
+ * @file displayBench.c
+ * @brief Host benchmark of the bus traffic of the display flushes, against the page-by-page flush.
+ *
+ * Every scenario draws a base screen, flushes it, then makes a change typical of the game and counts the
+ * I2C transactions and bytes needed to show it, on the mock HAL in 'Tools/mockHal':
+ *   - page addressing: the flush the driver used before the dirty tracking, which sends every page with
+ *     its own page and column commands (3 command transactions) and a data transaction of a whole page;
+ *   - 'ssd1306_UpdateScreen()': the blocking flush of the changed columns;
+ *   - 'ssd1306_UpdateScreenAsync()': the DMA flush of the changed columns.
+ * A byte counts the I2C address and the control byte of every transaction. The time is estimated from
+ * 9 bit times per byte and 2 for the start and stop conditions of every transaction, at the standard
+ * (100 kHz) and fast (400 kHz) mode clocks. After every flush, the emulated display RAM is checked against
+ * the screenbuffer.
+ *
+ * It also times drawing a 5x5 game board (grid lines and 25 filled cells, as 'drawField()' does) with the
+ * driver's byte-wise rectangles and lines against the same board drawn pixel by pixel, and writing menu
+ * text with the glyphs in page format against the row format. Finally, it times game frames drawn by
+ * 'drawField()' on its cached grid against frames that draw the grid and clear every cell, as it did
+ * before the cache, and frames that only redraw the cells changed by a cursor move, and reports the memory
+ * and hits of the cache.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ITools/mockHal -ICore/Inc Tools/displayBench.c Tools/mockHal/mockHal.c Core/Src/ssd1306.c \
+ *       Core/Src/ssd1306_fonts.c Core/Src/ssd1306_page_fonts.c Core/Src/drawField.c -lm -o displayBench
+ *
+ * Usage:
+ *   ./displayBench
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "stm32l4xx_hal.h"
+#include "ssd1306.h"
+#include "ssd1306_fonts.h"
+#include "gameConfiguration.h"
+#include "drawField.h"
+
+I2C_HandleTypeDef hi2c1; /**< The I2C handle the driver is configured for */
+
+/**
+ * @brief A screen drawn before the measurement and the change that is measured.
+ */
+typedef struct {
+	const char *name;
+	void (*drawBase)(void);
+	void (*drawChange)(void);
+} Scenario;
+
+/**
+ * @brief Draws the grid of a 4x4 board and a few pieces, as the game screen does.
+ */
+static void drawBoard(void) {
+	ssd1306_Fill(Black);
+	for (int line = 0; line <= 4; line++) {
+		ssd1306_Line(32 + line * 16, 0, 32 + line * 16, 63, White);
+		ssd1306_Line(32, line * 16 - (line == 4), 96, line * 16 - (line == 4), White);
+	}
+	ssd1306_Line(35, 3, 45, 13, White);
+	ssd1306_Line(45, 3, 35, 13, White);
+	ssd1306_DrawCircle(72, 24, 5, White);
+	ssd1306_Line(67, 35, 77, 45, White);
+	ssd1306_Line(77, 35, 67, 45, White);
+}
+
+/**
+ * @brief Draws a menu of three buttons with the first one selected, as the main menu does.
+ */
+static void drawMenu(void) {
+	static const char *const labels[] = { "Play", "Options", "Exit" };
+	ssd1306_Fill(Black);
+	for (int i = 0; i < 3; i++) {
+		ssd1306_SetCursor(30, 8 + i * 18);
+		ssd1306_WriteString((char*) labels[i], Font_7x10, White);
+	}
+	ssd1306_InvertRectangle(26, 6, 100, 19);
+}
+
+/**
+ * @brief Clears the screen.
+ */
+static void drawBlack(void) {
+	ssd1306_Fill(Black);
+}
+
+/**
+ * @brief Lights the whole screen, which changes every byte of the frame.
+ */
+static void drawWhite(void) {
+	ssd1306_Fill(White);
+}
+
+/**
+ * @brief Redraws the whole game screen after the base screen, as the main loop does after a move.
+ */
+static void redrawBoard(void) {
+	drawBoard();
+	ssd1306_Line(83, 51, 93, 61, White);
+	ssd1306_Line(93, 51, 83, 61, White);
+}
+
+/**
+ * @brief Draws a single cross into the board.
+ */
+static void drawCross(void) {
+	ssd1306_Line(51, 19, 61, 29, White);
+	ssd1306_Line(61, 19, 51, 29, White);
+}
+
+/**
+ * @brief Moves the selection of the menu to the second button.
+ */
+static void moveSelection(void) {
+	ssd1306_InvertRectangle(26, 6, 100, 19);
+	ssd1306_InvertRectangle(26, 24, 100, 37);
+}
+
+/**
+ * @brief Lights a single pixel.
+ */
+static void drawPixel(void) {
+	ssd1306_DrawPixel(100, 40, White);
+}
+
+/**
+ * @brief The measured scenarios.
+ */
+static const Scenario scenarios[] = {
+	{ "full frame", drawBlack, drawWhite },
+	{ "menu screen", drawBoard, drawMenu },
+	{ "board redraw after a move", drawBoard, redrawBoard },
+	{ "one cross", drawBoard, drawCross },
+	{ "menu selection", drawMenu, moveSelection },
+	{ "one pixel", drawBlack, drawPixel },
+};
+
+/**
+ * @brief Sends the whole screen as the page-by-page flush did.
+ *
+ * The emulated controller is switched to page addressing for it and back to horizontal addressing
+ * afterwards; these commands are not counted.
+ *
+ * @param screen The screen contents, 'mockDisplayPages' rows of 'mockDisplayWidth' bytes.
+ * @return The bus traffic of the flush.
+ */
+static MockBusCounts flushPages(uint8_t *screen) {
+	uint8_t mode[2] = { 0x20, 0x02 };
+	HAL_I2C_Mem_Write(&hi2c1, SSD1306_I2C_ADDR, 0x00, 1, mode, 2, HAL_MAX_DELAY);
+	MockClearCounts();
+	for (uint8_t page = 0; page < mockDisplayPages; page++) {
+		uint8_t commands[3] = { 0xB0 + page, 0x00 + SSD1306_X_OFFSET_LOWER, 0x10 + SSD1306_X_OFFSET_UPPER };
+		for (int i = 0; i < 3; i++)
+			HAL_I2C_Mem_Write(&hi2c1, SSD1306_I2C_ADDR, 0x00, 1, &commands[i], 1, HAL_MAX_DELAY);
+		HAL_I2C_Mem_Write(&hi2c1, SSD1306_I2C_ADDR, 0x40, 1, &screen[page * mockDisplayWidth], mockDisplayWidth,
+				HAL_MAX_DELAY);
+	}
+	MockBusCounts counts = MockGetCounts();
+	mode[1] = 0x00;
+	HAL_I2C_Mem_Write(&hi2c1, SSD1306_I2C_ADDR, 0x00, 1, mode, 2, HAL_MAX_DELAY);
+	return counts;
+}
+
+/**
+ * @brief Checks that the display shows the screenbuffer.
+ *
+ * The display RAM is saved, the whole screenbuffer is sent by a blocking flush, and the saved RAM is
+ * compared with the result.
+ *
+ * @return True if the display showed the screenbuffer.
+ */
+static bool showsBuffer(void) {
+	uint8_t shown[mockDisplayPages * mockDisplayWidth];
+	memcpy(shown, MockDisplayRam(), sizeof(shown));
+	ssd1306_MarkDirty(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1);
+	ssd1306_UpdateScreen();
+	return memcmp(shown, MockDisplayRam(), sizeof(shown)) == 0;
+}
+
+/**
+ * @brief Draws the base screen of a scenario and shows it, then clears the counts.
+ *
+ * @param scenario The scenario.
+ */
+static void showBase(const Scenario *scenario) {
+	scenario->drawBase();
+	ssd1306_UpdateScreen();
+	MockClearCounts();
+}
+
+/**
+ * @brief Prints one measured flush.
+ *
+ * @param path The name of the flush.
+ * @param counts The bus traffic of the flush.
+ * @param isCorrect True if the display showed the screenbuffer afterwards.
+ * @return True if the display showed the screenbuffer.
+ */
+static bool printCounts(const char *path, MockBusCounts counts, bool isCorrect) {
+	unsigned long bits = counts.bytes * 9 + counts.transactions * 2;
+	printf("  %-28s %5lu %6lu %8.2f %8.2f%s\n", path, counts.transactions, counts.bytes, bits / 100.0,
+			bits / 400.0, isCorrect ? "" : "  WRONG SCREEN");
+	return isCorrect;
+}
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Fills a rectangle pixel by pixel, as the driver did before its byte-wise paths.
+ */
+static void fillPixels(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
+	for (uint8_t y = y1; y <= y2 && y < SSD1306_HEIGHT; y++) {
+		for (uint8_t x = x1; x <= x2 && x < SSD1306_WIDTH; x++)
+			ssd1306_DrawPixel(x, y, color);
+	}
+}
+
+/**
+ * @brief Draws a 5x5 game board: the grid, then every cell filled, with the active cell lit.
+ *
+ * @param fill The function filling rectangles and drawing the axis-aligned grid lines.
+ */
+static void drawGameBoard(void (*fill)(uint8_t, uint8_t, uint8_t, uint8_t, SSD1306_COLOR)) {
+	const int size = 5, top = 8, cellSize = (64 - top) / size, margin = (128 - cellSize * size) / 2;
+	ssd1306_Fill(Black);
+	for (int i = 0; i <= size; i++) {
+		fill(margin + cellSize * i, top, margin + cellSize * i, 63, White);
+		fill(margin, top + cellSize * i, 128 - margin, top + cellSize * i, White);
+	}
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			int left = margin + cellSize * x, upper = top + cellSize * y;
+			fill(left + 1, upper + 1, left + cellSize - 1, upper + cellSize - 1, x == 2 && y == 2 ? White : Black);
+		}
+	}
+}
+
+/**
+ * @brief Times drawing the game board.
+ *
+ * @param fill The function filling rectangles and drawing the axis-aligned grid lines.
+ * @param frames The number of frames to draw.
+ * @return The time per frame in microseconds.
+ */
+static double timeGameBoard(void (*fill)(uint8_t, uint8_t, uint8_t, uint8_t, SSD1306_COLOR), int frames) {
+	double start = now();
+	for (int frame = 0; frame < frames; frame++) {
+		drawGameBoard(fill);
+		ssd1306_DrawPixel(frame % 2, 0, White);
+	}
+	return (now() - start) * 1e6 / frames;
+}
+
+/**
+ * @brief Writes the menu texts of the game, in both fonts it uses, at unaligned rows.
+ *
+ * @param small The 6x8 font.
+ * @param large The 7x10 font.
+ */
+static void writeMenuText(SSD1306_Font_t small, SSD1306_Font_t large) {
+	static const char *const labels[] = { "Play", "Options", "Exit", "Field size: 5", "Difficulty: 3" };
+	ssd1306_Fill(Black);
+	for (int i = 0; i < 5; i++) {
+		ssd1306_SetCursor(10, 1 + i * 12);
+		ssd1306_WriteString((char*) labels[i], i < 3 ? large : small, i == 1 ? Black : White);
+	}
+}
+
+/**
+ * @brief Times writing the menu texts.
+ *
+ * @param small The 6x8 font.
+ * @param large The 7x10 font.
+ * @param frames The number of frames to draw.
+ * @return The time per frame in microseconds.
+ */
+static double timeMenuText(SSD1306_Font_t small, SSD1306_Font_t large, int frames) {
+	double start = now();
+	for (int frame = 0; frame < frames; frame++) {
+		writeMenuText(small, large);
+		ssd1306_DrawPixel(frame % 2, 0, White);
+	}
+	return (now() - start) * 1e6 / frames;
+}
+
+void drawCells(char field[maxFieldSize][maxFieldSize], int fieldSize, bool invert);
+void drawXO(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert,
+		int heatMap[maxFieldSize][maxFieldSize], int hintCellX, int hintCellY);
+
+/**
+ * @brief A 5x5 game in progress, as the game frames show it.
+ */
+static char benchField[maxFieldSize][maxFieldSize] = {
+	{ 'x', ' ', ' ', 'o', ' ' },
+	{ ' ', 'o', 'x', ' ', ' ' },
+	{ ' ', ' ', 'x', ' ', ' ' },
+	{ ' ', 'o', ' ', ' ', ' ' },
+	{ ' ', ' ', ' ', ' ', 'x' },
+};
+
+/**
+ * @brief Draws a game frame as before the grid cache: the grid, every cell cleared, then the pieces.
+ *
+ * @param activeCell The index of the active cell.
+ */
+static void drawUncachedFrame(int activeCell) {
+	const int size = 5, cellSize = (HEIGHT - playerTextCorrection) / size;
+	const int xMargin = (WIDTH - cellSize * size) / 2;
+	ssd1306_Fill(Black);
+	drawCells(benchField, size, false);
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			int left = xMargin + cellSize * x, upper = playerTextCorrection + cellSize * y;
+			ssd1306_FillRectangle(left + 1, upper + 1, left + cellSize - 1, upper + cellSize - 1, Black);
+		}
+	}
+	drawXO(benchField, size, activeCell % size, activeCell / size % size, false, NULL, -1, -1);
+}
+
+/**
+ * @brief Draws a whole game frame on the cached grid.
+ *
+ * @param activeCell The index of the active cell.
+ */
+static void drawCachedFrame(int activeCell) {
+	BoardViewInvalidate();
+	drawField(benchField, 5, activeCell % 5, activeCell / 5 % 5, false, NULL, -1, -1);
+}
+
+/**
+ * @brief Draws a game frame over the previous one, redrawing the cells that changed.
+ *
+ * @param activeCell The index of the active cell.
+ */
+static void drawRetainedFrame(int activeCell) {
+	drawField(benchField, 5, activeCell % 5, activeCell / 5 % 5, false, NULL, -1, -1);
+}
+
+/**
+ * @brief Times drawing game frames, moving the active cell from frame to frame.
+ *
+ * @param draw The function drawing a frame.
+ * @param frames The number of frames to draw.
+ * @return The time per frame in microseconds.
+ */
+static double timeGameFrames(void (*draw)(int), int frames) {
+	double start = now();
+	for (int frame = 0; frame < frames; frame++)
+		draw(frame);
+	return (now() - start) * 1e6 / frames;
+}
+
+int main(void) {
+	int failures = 0;
+	MockReset();
+	ssd1306_Init();
+
+	printf("  %-28s %5s %6s %8s %8s\n", "flush", "txns", "bytes", "ms@100k", "ms@400k");
+	for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+		const Scenario *scenario = &scenarios[s];
+		printf("%s\n", scenario->name);
+
+		uint8_t screen[mockDisplayPages * mockDisplayWidth];
+		showBase(scenario);
+		scenario->drawChange();
+		ssd1306_UpdateScreen();
+		memcpy(screen, MockDisplayRam(), sizeof(screen));
+		showBase(scenario);
+		MockBusCounts counts = flushPages(screen);
+		bool isCorrect = memcmp(screen, MockDisplayRam(), sizeof(screen)) == 0;
+		failures += !printCounts("page addressing", counts, isCorrect);
+
+		showBase(scenario);
+		scenario->drawChange();
+		ssd1306_UpdateScreen();
+		counts = MockGetCounts();
+		failures += !printCounts("ssd1306_UpdateScreen", counts, showsBuffer());
+
+		showBase(scenario);
+		scenario->drawChange();
+		ssd1306_UpdateScreenAsync();
+		while (MockDmaPending())
+			MockDmaComplete();
+		counts = MockGetCounts();
+		failures += !printCounts("ssd1306_UpdateScreenAsync", counts, showsBuffer());
+	}
+
+	uint8_t pixelScreen[mockDisplayPages * mockDisplayWidth];
+	drawGameBoard(fillPixels);
+	ssd1306_UpdateScreen();
+	memcpy(pixelScreen, MockDisplayRam(), sizeof(pixelScreen));
+	drawGameBoard(ssd1306_FillRectangle);
+	ssd1306_UpdateScreen();
+	bool isSame = memcmp(pixelScreen, MockDisplayRam(), sizeof(pixelScreen)) == 0;
+	failures += !isSame;
+
+	const int frames = 20000;
+	double pixelTime = timeGameBoard(fillPixels, frames);
+	double byteTime = timeGameBoard(ssd1306_FillRectangle, frames);
+	printf("5x5 board render\n");
+	printf("  %-28s %8.2f us/frame\n", "pixel by pixel", pixelTime);
+	printf("  %-28s %8.2f us/frame  %.1fx%s\n", "byte-wise", byteTime, pixelTime / byteTime,
+			isSame ? "" : "  WRONG SCREEN");
+
+	SSD1306_Font_t smallRows = { Font_6x8.width, Font_6x8.height, Font_6x8.data, Font_6x8.char_width, NULL };
+	SSD1306_Font_t largeRows = { Font_7x10.width, Font_7x10.height, Font_7x10.data, Font_7x10.char_width, NULL };
+	writeMenuText(smallRows, largeRows);
+	ssd1306_UpdateScreen();
+	memcpy(pixelScreen, MockDisplayRam(), sizeof(pixelScreen));
+	writeMenuText(Font_6x8, Font_7x10);
+	ssd1306_UpdateScreen();
+	isSame = memcmp(pixelScreen, MockDisplayRam(), sizeof(pixelScreen)) == 0;
+	failures += !isSame;
+
+	double rowTime = timeMenuText(smallRows, largeRows, frames);
+	double pageTime = timeMenuText(Font_6x8, Font_7x10, frames);
+	printf("menu text render\n");
+	printf("  %-28s %8.2f us/frame\n", "row format", rowTime);
+	printf("  %-28s %8.2f us/frame  %.1fx%s\n", "page format", pageTime, rowTime / pageTime,
+			isSame ? "" : "  WRONG SCREEN");
+
+	isSame = true;
+	for (int cell = 0; cell < 25; cell++) {
+		drawUncachedFrame(cell);
+		ssd1306_UpdateScreen();
+		memcpy(pixelScreen, MockDisplayRam(), sizeof(pixelScreen));
+		drawCachedFrame(cell);
+		ssd1306_UpdateScreen();
+		isSame &= memcmp(pixelScreen, MockDisplayRam(), sizeof(pixelScreen)) == 0;
+	}
+	bool isRetainedSame = true;
+	for (int cell = 0; cell < 25; cell++) {
+		drawRetainedFrame(cell);
+		ssd1306_UpdateScreen();
+		memcpy(pixelScreen, MockDisplayRam(), sizeof(pixelScreen));
+		drawUncachedFrame(cell);
+		ssd1306_UpdateScreen();
+		isRetainedSame &= memcmp(pixelScreen, MockDisplayRam(), sizeof(pixelScreen)) == 0;
+	}
+	failures += !isRetainedSame;
+	failures += !isSame;
+
+	double uncachedTime = timeGameFrames(drawUncachedFrame, frames);
+	double cachedTime = timeGameFrames(drawCachedFrame, frames);
+	double retainedTime = timeGameFrames(drawRetainedFrame, frames);
+	GridCacheStats stats;
+	GridCacheGetStats(&stats);
+	printf("5x5 game frame render\n");
+	printf("  %-28s %8.2f us/frame\n", "grid drawn", uncachedTime);
+	printf("  %-28s %8.2f us/frame  %.1fx%s\n", "cached grid", cachedTime, uncachedTime / cachedTime,
+			isSame ? "" : "  WRONG SCREEN");
+	printf("  %-28s %8.2f us/frame  %.1fx%s\n", "changed cells", retainedTime, uncachedTime / retainedTime,
+			isRetainedSame ? "" : "  WRONG SCREEN");
+	printf("  grid cache: %zu bytes, %d slots, %lu hits, %lu misses\n", stats.bytes, stats.slots, stats.hits,
+			stats.misses);
+
+	if (failures > 0)
+		printf("%d flushes or renders left a wrong screen\n", failures);
+	return failures > 0;
+}
@@ -0,0 +1,463 @@
+/**
+ * @file displayCheck.c
+ * @brief Host tool checking the display driver's flushes against an emulated SSD1306.
+ *
+ * The driver in 'Core/Src/ssd1306.c' is built against the mock HAL in 'Tools/mockHal', which emulates
+ * the controller's display RAM. Every scenario draws with the driver's primitives, flushes, and checks
+ * that the emulated RAM holds the screenbuffer, read back by a full blocking flush. The scenarios cover
+ * the dirty-region flush of 'ssd1306_UpdateScreen()' and the state machine of
+ * 'ssd1306_UpdateScreenAsync()': the busy flag, the completion callback, drawing while a transfer is
+ * running, whole frames with the double buffer, and recovery from a failed transfer. Rectangles, lines
+ * and text drawn a byte at a time are compared with the same shapes drawn pixel by pixel, and game boards
+ * drawn on the cached grid of 'drawField()' with boards drawn on a freshly drawn grid. Sequences of game
+ * states redrawn cell by cell by 'drawField()' are compared with each state drawn on a fresh screen, and
+ * inverting the colors must take a single command.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ITools/mockHal -ICore/Inc Tools/displayCheck.c Tools/mockHal/mockHal.c Core/Src/ssd1306.c \
+ *       Core/Src/ssd1306_fonts.c Core/Src/ssd1306_page_fonts.c Core/Src/drawField.c -lm -o displayCheck
+ *
+ * Usage:
+ *   ./displayCheck [rounds]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32l4xx_hal.h"
+#include "ssd1306.h"
+#include "ssd1306_fonts.h"
+#include "gameConfiguration.h"
+#include "minimax.h"
+#include "drawField.h"
+
+I2C_HandleTypeDef hi2c1; /**< The I2C handle the driver is configured for */
+SPI_HandleTypeDef hspi1; /**< The SPI handle the driver is configured for with SSD1306_USE_SPI */
+
+#ifdef SSD1306_USE_SPI
+#define transactionOverhead 0 /**< Bytes on the bus per transfer besides the payload */
+#else
+#define transactionOverhead 2 /**< Bytes on the bus per transaction besides the payload: address and control */
+#endif
+
+static int completions; /**< Number of calls of the completion callback */
+static SSD1306_Error_t lastStatus; /**< Status of the last completion */
+static int failures; /**< Number of failed checks */
+
+void drawCells(char field[maxFieldSize][maxFieldSize], int fieldSize, bool invert);
+void drawXO(char field[maxFieldSize][maxFieldSize], int fieldSize, int activeCellX, int activeCellY, bool invert,
+		int heatMap[maxFieldSize][maxFieldSize], int hintCellX, int hintCellY);
+
+void ssd1306_UpdateScreenCpltCallback(SSD1306_Error_t status) {
+	completions++;
+	lastStatus = status;
+}
+
+/**
+ * @brief Reports the result of a check.
+ *
+ * @param name The name of the check.
+ * @param isPassed True if the check passed.
+ */
+static void report(const char *name, bool isPassed) {
+	printf("%-40s %s\n", name, isPassed ? "ok" : "FAIL");
+	failures += !isPassed;
+}
+
+/**
+ * @brief Checks that the display shows the screenbuffer.
+ *
+ * The display RAM is saved, the whole screenbuffer is sent by a blocking flush, and the saved RAM is
+ * compared with the result.
+ *
+ * @return True if the display showed the screenbuffer.
+ */
+static bool showsBuffer(void) {
+	uint8_t shown[mockDisplayPages * mockDisplayWidth];
+	memcpy(shown, MockDisplayRam(), sizeof(shown));
+	ssd1306_MarkDirty(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1);
+	ssd1306_UpdateScreen();
+	return memcmp(shown, MockDisplayRam(), sizeof(shown)) == 0;
+}
+
+/**
+ * @brief Draws a random primitive.
+ */
+static void drawRandom(void) {
+	uint8_t x1 = rand() % SSD1306_WIDTH, y1 = rand() % SSD1306_HEIGHT;
+	uint8_t x2 = rand() % SSD1306_WIDTH, y2 = rand() % SSD1306_HEIGHT;
+	SSD1306_COLOR color = rand() % 2 ? White : Black;
+	switch (rand() % 7) {
+	case 0:
+		ssd1306_DrawPixel(x1, y1, color);
+		break;
+	case 1:
+		ssd1306_Line(x1, y1, x2, y2, color);
+		break;
+	case 2:
+		ssd1306_FillRectangle(x1, y1, x2, y2, color);
+		break;
+	case 3:
+		ssd1306_DrawRectangle(x1, y1, x2, y2, color);
+		break;
+	case 4:
+		ssd1306_InvertRectangle(x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, x1 < x2 ? x2 : x1, y1 < y2 ? y2 : y1);
+		break;
+	case 5:
+		ssd1306_SetCursor(x1 % 100, y1 % 50);
+		ssd1306_WriteString("Ab1", Font_7x10, color);
+		break;
+	default:
+		if (rand() % 4 == 0)
+			ssd1306_Fill(color);
+		break;
+	}
+}
+
+/**
+ * @brief Draws a frame of random primitives on a cleared screen.
+ *
+ * @param seed The seed of the primitives; the same seed draws the same frame.
+ */
+static void drawFrame(unsigned seed) {
+	srand(seed);
+	ssd1306_Fill(Black);
+	for (int i = 0; i < 6; i++)
+		drawRandom();
+}
+
+/**
+ * @brief Draws a rectangle, filled or as its outline, pixel by pixel as a reference.
+ *
+ * Pixels off the screen are skipped by 'ssd1306_DrawPixel()'.
+ *
+ * @param x1 The X-coordinate of one corner.
+ * @param y1 The Y-coordinate of one corner.
+ * @param x2 The X-coordinate of the opposite corner.
+ * @param y2 The Y-coordinate of the opposite corner.
+ * @param isFilled True for a filled rectangle, false for the outline.
+ * @param color The color.
+ */
+static void drawPixels(int x1, int y1, int x2, int y2, bool isFilled, SSD1306_COLOR color) {
+	int left = x1 < x2 ? x1 : x2, right = x1 < x2 ? x2 : x1;
+	int top = y1 < y2 ? y1 : y2, bottom = y1 < y2 ? y2 : y1;
+	for (int y = top; y <= bottom; y++) {
+		for (int x = left; x <= right; x++) {
+			if (isFilled || x == left || x == right || y == top || y == bottom)
+				ssd1306_DrawPixel(x, y, color);
+		}
+	}
+}
+
+/**
+ * @brief Returns the display RAM after a blocking flush.
+ *
+ * @param shown Receives the display RAM.
+ */
+static void readScreen(uint8_t shown[mockDisplayPages * mockDisplayWidth]) {
+	ssd1306_UpdateScreen();
+	memcpy(shown, MockDisplayRam(), mockDisplayPages * mockDisplayWidth);
+}
+
+/**
+ * @brief Completes DMA transfers until the asynchronous flush has finished.
+ */
+static void finishTransfers(void) {
+	while (MockDmaPending())
+		MockDmaComplete();
+}
+
+int main(int argc, char **argv) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 200;
+	srand(1);
+
+	MockReset();
+#ifdef SSD1306_USE_SPI
+	MockSpiPins(SSD1306_CS_Port, SSD1306_CS_Pin, SSD1306_DC_Port, SSD1306_DC_Pin);
+#endif
+	ssd1306_Init();
+	MockBusCounts counts = MockGetCounts();
+	report("init", counts.transactions == 1 + 2 && showsBuffer() && !ssd1306_IsDirty());
+
+	bool isPassed = true;
+	for (int round = 0; round < rounds; round++) {
+		for (int i = rand() % 4; i >= 0; i--)
+			drawRandom();
+		ssd1306_UpdateScreen();
+		isPassed &= !ssd1306_IsDirty();
+		uint8_t shown[mockDisplayPages * mockDisplayWidth];
+		memcpy(shown, MockDisplayRam(), sizeof(shown));
+		isPassed &= showsBuffer() && memcmp(shown, MockDisplayRam(), sizeof(shown)) == 0;
+	}
+	report("blocking dirty flush", isPassed);
+
+	ssd1306_Fill(Black);
+	ssd1306_UpdateScreen();
+	MockClearCounts();
+	ssd1306_FillRectangle(40, 20, 50, 30, White);
+	ssd1306_UpdateScreen();
+	counts = MockGetCounts();
+	report("blocking flush of an 11x11 rectangle", showsBuffer());
+	printf("  %lu transactions, %lu bytes on the bus\n", counts.transactions, counts.bytes);
+
+	MockClearCounts();
+	ssd1306_Fill(White);
+	ssd1306_UpdateScreen();
+	counts = MockGetCounts();
+	isPassed = counts.transactions == 2 && counts.bytes == 2 * transactionOverhead + 6 + SSD1306_BUFFER_SIZE;
+	report("full frame in one data transaction", isPassed && showsBuffer());
+
+	MockClearCounts();
+	ssd1306_Fill(Black);
+	ssd1306_UpdateScreenAsync();
+	finishTransfers();
+	counts = MockGetCounts();
+	isPassed = counts.transactions == 2 && counts.bytes == 2 * transactionOverhead + 6 + SSD1306_BUFFER_SIZE;
+#ifdef SSD1306_USE_SPI
+	isPassed &= counts.dcChanges <= 2;
+#endif
+	report("full async frame in one data transfer", isPassed && showsBuffer());
+	printf("  %lu transfers, %lu bytes: %.2f ms at %s\n", counts.transactions, counts.bytes,
+#ifdef SSD1306_USE_SPI
+			counts.bytes * 8 / 10e3, "10 MHz SPI");
+#else
+			(counts.bytes * 9 + counts.transactions * 2) / 400.0, "400 kHz I2C");
+#endif
+
+	isPassed = true;
+	for (int round = 0; round < rounds * 10; round++) {
+		uint8_t x1 = rand() % (SSD1306_WIDTH + 16), y1 = rand() % (SSD1306_HEIGHT + 16);
+		uint8_t x2 = rand() % (SSD1306_WIDTH + 16), y2 = rand() % (SSD1306_HEIGHT + 16);
+		SSD1306_COLOR color = rand() % 2 ? White : Black;
+		int kind = rand() % 4;
+		if (kind == 1)
+			y2 = y1;
+		else if (kind == 2)
+			x2 = x1;
+		uint8_t expected[mockDisplayPages * mockDisplayWidth], drawn[mockDisplayPages * mockDisplayWidth];
+		unsigned seed = round + 1;
+		drawFrame(seed);
+		drawPixels(x1, y1, x2, y2, kind != 3, color);
+		readScreen(expected);
+		drawFrame(seed);
+		if (kind == 0)
+			ssd1306_FillRectangle(x1, y1, x2, y2, color);
+		else if (kind == 3)
+			ssd1306_DrawRectangle(x1, y1, x2, y2, color);
+		else
+			ssd1306_Line(x1, y1, x2, y2, color);
+		readScreen(drawn);
+		isPassed &= memcmp(expected, drawn, sizeof(drawn)) == 0 && showsBuffer();
+	}
+	report("byte-wise rectangles and lines", isPassed);
+
+	const SSD1306_Font_t *pageFonts[] = { &Font_6x8, &Font_7x10 };
+	isPassed = true;
+	for (int round = 0; round < rounds * 10; round++) {
+		const SSD1306_Font_t *font = pageFonts[round % 2];
+		SSD1306_Font_t rowFont = { font->width, font->height, font->data, font->char_width, NULL };
+		char text[8];
+		for (int i = 0; i < (int) sizeof(text) - 1; i++)
+			text[i] = 32 + rand() % 95;
+		text[rand() % sizeof(text)] = '\0';
+		uint8_t x = rand() % SSD1306_WIDTH, y = rand() % SSD1306_HEIGHT;
+		SSD1306_COLOR color = rand() % 2 ? White : Black;
+		uint8_t expected[mockDisplayPages * mockDisplayWidth], drawn[mockDisplayPages * mockDisplayWidth];
+		unsigned seed = round + 1;
+		drawFrame(seed);
+		ssd1306_SetCursor(x, y);
+		char expectedEnd = ssd1306_WriteString(text, rowFont, color);
+		readScreen(expected);
+		drawFrame(seed);
+		ssd1306_SetCursor(x, y);
+		isPassed &= ssd1306_WriteString(text, *font, color) == expectedEnd;
+		readScreen(drawn);
+		isPassed &= memcmp(expected, drawn, sizeof(drawn)) == 0 && showsBuffer();
+	}
+	report("text in page format", isPassed);
+
+	isPassed = true;
+	for (int round = 0; round < rounds * 10; round++) {
+		char field[maxFieldSize][maxFieldSize];
+		int heatMap[maxFieldSize][maxFieldSize];
+		int fieldSize = 3 + rand() % 3;
+		for (int y = 0; y < maxFieldSize; y++) {
+			for (int x = 0; x < maxFieldSize; x++) {
+				field[y][x] = " xo"[rand() % 3];
+				heatMap[y][x] = field[y][x] == ' ' ? rand() % 200 - 100 : noScore;
+			}
+		}
+		int activeX = rand() % (fieldSize + 1) - 1, activeY = rand() % fieldSize;
+		int hintX = rand() % (fieldSize + 1) - 1, hintY = rand() % fieldSize;
+		bool invert = rand() % 2, isHeatMap = rand() % 2;
+		uint8_t expected[mockDisplayPages * mockDisplayWidth], drawn[mockDisplayPages * mockDisplayWidth];
+		unsigned seed = round + 1;
+		drawFrame(seed);
+		ssd1306_Fill(invert ? White : Black);
+		drawCells(field, fieldSize, invert);
+		drawXO(field, fieldSize, activeX, activeY, invert, isHeatMap ? heatMap : NULL, hintX, hintY);
+		readScreen(expected);
+		drawFrame(seed);
+		BoardViewInvalidate();
+		drawField(field, fieldSize, activeX, activeY, invert, isHeatMap ? heatMap : NULL, hintX, hintY);
+		readScreen(drawn);
+		isPassed &= memcmp(expected, drawn, sizeof(drawn)) == 0 && showsBuffer();
+	}
+	GridCacheStats stats;
+	GridCacheGetStats(&stats);
+	report("game boards on the cached grid", isPassed && stats.hits > 0 && stats.misses > 0);
+	printf("  %zu bytes, %d slots, %lu hits, %lu misses\n", stats.bytes, stats.slots, stats.hits, stats.misses);
+
+	isPassed = true;
+	for (int game = 0; game < rounds / 4 + 1; game++) {
+		char field[maxFieldSize][maxFieldSize];
+		int heatMap[maxFieldSize][maxFieldSize];
+		int fieldSize = 3 + rand() % 3, activeX = 0, activeY = 0, hintX = -1, hintY = -1;
+		bool invert = false, isHeatMap = false;
+		memset(field, ' ', sizeof(field));
+		BoardViewInvalidate();
+		for (int step = 0; step < 40; step++) {
+			switch (rand() % 8) {
+			case 0:
+			case 1:
+			case 2:
+				activeX = (activeX + rand() % 3 + fieldSize - 1) % fieldSize;
+				activeY = (activeY + rand() % 3 + fieldSize - 1) % fieldSize;
+				break;
+			case 3:
+			case 4:
+				field[rand() % fieldSize][rand() % fieldSize] = " xo"[rand() % 3];
+				break;
+			case 5:
+				hintX = rand() % (fieldSize + 1) - 1;
+				hintY = rand() % fieldSize;
+				break;
+			case 6:
+				isHeatMap = !isHeatMap;
+				for (int y = 0; y < maxFieldSize; y++) {
+					for (int x = 0; x < maxFieldSize; x++)
+						heatMap[y][x] = field[y][x] == ' ' ? rand() % 200 - 100 : noScore;
+				}
+				break;
+			default:
+				if (rand() % 2)
+					invert = !invert;
+				else
+					fieldSize = 3 + rand() % 3;
+				activeX %= fieldSize;
+				activeY %= fieldSize;
+				break;
+			}
+			uint8_t expected[mockDisplayPages * mockDisplayWidth], drawn[mockDisplayPages * mockDisplayWidth];
+			drawField(field, fieldSize, activeX, activeY, invert, isHeatMap ? heatMap : NULL, hintX, hintY);
+			readScreen(drawn);
+			drawFrame(game * 40 + step + 1);
+			BoardViewInvalidate();
+			drawField(field, fieldSize, activeX, activeY, invert, isHeatMap ? heatMap : NULL, hintX, hintY);
+			readScreen(expected);
+			isPassed &= memcmp(expected, drawn, sizeof(drawn)) == 0 && showsBuffer();
+		}
+	}
+	report("game boards redrawn cell by cell", isPassed);
+
+	drawFrame(1);
+	ssd1306_UpdateScreen();
+	MockClearCounts();
+	ssd1306_SetInvert(1);
+	counts = MockGetCounts();
+	isPassed = MockDisplayInverted() && ssd1306_GetInvert() && counts.transactions == 1
+			&& counts.bytes == transactionOverhead + 1;
+	ssd1306_SetInvert(0);
+	isPassed &= !MockDisplayInverted() && !ssd1306_GetInvert() && !ssd1306_IsDirty() && showsBuffer();
+	report("inverted colors in one command", isPassed);
+
+	completions = 0;
+	isPassed = ssd1306_UpdateScreenAsync() == SSD1306_OK && !MockDmaPending() && completions == 1
+			&& lastStatus == SSD1306_OK;
+	report("async flush without changes", isPassed);
+
+	isPassed = true;
+	for (int round = 0; round < rounds; round++) {
+		for (int i = rand() % 4; i >= 0; i--)
+			drawRandom();
+		completions = 0;
+#ifdef SSD1306_USE_DMA
+		bool isPending = ssd1306_IsDirty();
+#else
+		bool isPending = false;
+#endif
+		isPassed &= ssd1306_UpdateScreenAsync() == SSD1306_OK;
+		isPassed &= ssd1306_IsBusy() == isPending;
+		isPassed &= ssd1306_UpdateScreenAsync() == (isPending ? SSD1306_BUSY : SSD1306_OK);
+		isPassed &= mockPrimask == 0;
+		finishTransfers();
+		isPassed &= !ssd1306_IsBusy() && completions == (isPending ? 1 : 2) && lastStatus == SSD1306_OK;
+		isPassed &= showsBuffer();
+	}
+	report("async flush, busy flag and callback", isPassed);
+
+	isPassed = true;
+	for (int round = 0; round < rounds; round++) {
+		for (int i = rand() % 4; i >= 0; i--)
+			drawRandom();
+		ssd1306_UpdateScreenAsync();
+		while (MockDmaPending()) {
+			drawRandom();
+			MockDmaComplete();
+		}
+		while (ssd1306_IsDirty()) {
+			ssd1306_UpdateScreenAsync();
+			finishTransfers();
+		}
+		isPassed &= showsBuffer();
+	}
+	report("drawing during async transfers", isPassed);
+
+#ifdef SSD1306_DOUBLE_BUFFER
+	isPassed = true;
+	for (int round = 0; round < rounds; round++) {
+		uint8_t frame[mockDisplayPages * mockDisplayWidth];
+		drawFrame(2 * round + 2);
+		ssd1306_UpdateScreen();
+		memcpy(frame, MockDisplayRam(), sizeof(frame));
+		drawFrame(2 * round + 1);
+		ssd1306_UpdateScreen();
+		drawFrame(2 * round + 2);
+		ssd1306_UpdateScreenAsync();
+		while (MockDmaPending()) {
+			drawRandom();
+			MockDmaComplete();
+		}
+		isPassed &= memcmp(frame, MockDisplayRam(), sizeof(frame)) == 0;
+		while (ssd1306_IsDirty()) {
+			ssd1306_UpdateScreenAsync();
+			finishTransfers();
+		}
+		isPassed &= showsBuffer();
+	}
+	report("whole frames with the double buffer", isPassed);
+#endif
+
+	isPassed = true;
+	for (int round = 0; round < rounds; round++) {
+		ssd1306_Fill(round % 2 ? White : Black);
+		for (int i = rand() % 4; i >= 0; i--)
+			drawRandom();
+		completions = 0;
+		ssd1306_UpdateScreenAsync();
+		for (int steps = rand() % 4; steps > 0 && MockDmaPending(); steps--)
+			MockDmaComplete();
+		if (!MockDmaPending())
+			continue;
+		MockDmaFail();
+		isPassed &= completions == 1 && lastStatus == SSD1306_ERR && !ssd1306_IsBusy() && ssd1306_IsDirty();
+		ssd1306_UpdateScreenAsync();
+		finishTransfers();
+		isPassed &= completions == 2 && lastStatus == SSD1306_OK && !ssd1306_IsDirty() && showsBuffer();
+	}
+	report("recovery from failed transfers", isPassed);
+
+	if (failures > 0)
+		printf("%d checks failed\n", failures);
+	return failures > 0;
+}
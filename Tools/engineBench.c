@@ -0,0 +1,155 @@
+/**
+ * @file engineBench.c
+ * @brief Host benchmark comparing the registered move engines per board size.
+ *
+ * For every engine, every board size it supports and a few search budgets, the benchmark lets the engine
+ * choose moves on a fixed set of random, undecided positions with the computer to move, and reports the
+ * average and worst latency per move, the average number of search nodes, and how often the chosen
+ * move does not lose by force according to the proof-number search, counted over the positions that
+ * still have a move that is not proven to lose. The fastest engine whose non-losing rate meets the
+ * strength target is the one to select for a size in 'engine.c'.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc -DPN_NODE_POOL_SIZE=4000 Tools/engineBench.c Core/Src/engine.c Core/Src/tableEngine.c \
+ *       Core/Src/moveTable3x3.c Core/Src/minimax.c Core/Src/proofNumber.c Core/Src/evaluation.c \
+ *       Core/Src/evalTables.c Core/Src/winChecks.c -o engineBench
+ *
+ * Usage:
+ *   ./engineBench [positions]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gameConfiguration.h"
+#include "engine.h"
+#include "proofNumber.h"
+#include "winChecks.h"
+
+#define maxPositions 1000 /**< Largest supported number of positions per board size */
+
+/**
+ * @brief Search budgets every engine is measured with; engines that do not search ignore them.
+ */
+static const EngineBudget budgets[] = {
+	{ 0, 0 },
+	{ 0, 2000 },
+};
+
+#define budgetCount ((int) (sizeof(budgets) / sizeof(budgets[0]))) /**< Number of measured budgets */
+
+static char positions[maxPositions][maxFieldSize][maxFieldSize];
+static bool losing[maxPositions][maxFieldSize][maxFieldSize];
+static bool isSaveable[maxPositions]; /**< True if the position has a move that is not proven to lose */
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Generates the positions of one board size and marks the moves that lose by force.
+ *
+ * The positions are reachable in a normal game: the player has one piece more than the computer.
+ *
+ * @param size The size of the game board.
+ * @param count The number of positions.
+ * @return The number of positions that have a move that is not proven to lose.
+ */
+static int generatePositions(int size, int count) {
+	int saveableCount = 0;
+	srand(size);
+	for (int p = 0; p < count; p++) {
+		char (*board)[maxFieldSize] = positions[p];
+		do {
+			memset(board, 0, maxFieldSize * maxFieldSize);
+			int pieces = 1 + 2 * (rand() % (size * size / 2 - 1));
+			for (int k = 0; k < pieces;) {
+				int cell = rand() % (size * size);
+				if (board[cell / size][cell % size] != '\0')
+					continue;
+				board[cell / size][cell % size] = k % 2 ? secondPlayerChar : firstPlayerChar;
+				k++;
+			}
+		} while (checkWin(board, size) != '\0');
+
+		isSaveable[p] = false;
+		for (int i = 0; i < size; i++) {
+			for (int j = 0; j < size; j++) {
+				int x, y;
+				losing[p][i][j] = false;
+				if (board[i][j] != '\0')
+					continue;
+				board[i][j] = secondPlayerChar;
+				losing[p][i][j] = ProofNumberSolve(board, size, firstPlayerChar, &x, &y) == pnProvenWin;
+				board[i][j] = '\0';
+				isSaveable[p] |= !losing[p][i][j];
+			}
+		}
+		saveableCount += isSaveable[p];
+	}
+
+	return saveableCount;
+}
+
+int main(int argc, char **argv) {
+	int positionCount = argc > 1 ? atoi(argv[1]) : 100;
+	if (positionCount < 1 || positionCount > maxPositions) {
+		fprintf(stderr, "expected 1..%d positions\n", maxPositions);
+		return 2;
+	}
+
+	printf("%-8s %-4s %-12s %10s %10s %10s %10s\n", "engine", "size", "budget", "avg ms", "max ms", "nodes",
+			"non-losing");
+	for (int size = 3; size <= maxFieldSize; size++) {
+		int saveableCount = generatePositions(size, positionCount);
+
+		for (int e = 0; e < EngineCount(); e++) {
+			const Engine *engine = EngineAt(e);
+			if ((engine->sizes & engineSize(size)) == 0)
+				continue;
+			if (engine->init != NULL)
+				engine->init();
+
+			for (int b = 0; b < budgetCount; b++) {
+				double total = 0, worst = 0;
+				unsigned long nodes = 0;
+				int safeMoves = 0;
+
+				for (int p = 0; p < positionCount; p++) {
+					int row, column;
+					EngineStats stats = { 0 };
+					if (engine->newGame != NULL)
+						engine->newGame(size);
+
+					double start = now();
+					bool isFound = engine->search(positions[p], size, &budgets[b], &row, &column);
+					double elapsed = now() - start;
+
+					total += elapsed;
+					worst = elapsed > worst ? elapsed : worst;
+					if (engine->stats != NULL)
+						engine->stats(&stats);
+					nodes += stats.nodes;
+					safeMoves += isSaveable[p] && isFound && !losing[p][row][column];
+				}
+
+				char budget[16];
+				snprintf(budget, sizeof(budget), "d%d/n%lu", budgets[b].maxDepth, budgets[b].maxNodes);
+				printf("%-8s %dx%d  %-12s %10.3f %10.3f %10lu %9.1f%%\n", engine->name, size, size, budget,
+						total * 1e3 / positionCount, worst * 1e3, nodes / positionCount,
+						saveableCount > 0 ? 100.0 * safeMoves / saveableCount : 100.0);
+			}
+
+			if (engine->release != NULL)
+				engine->release();
+		}
+	}
+
+	return 0;
+}
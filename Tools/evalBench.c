@@ -0,0 +1,70 @@
+/**
+ * @file evalBench.c
+ * @brief Host microbenchmark of the table-driven static evaluation.
+ *
+ * The benchmark builds a fixed set of random, undecided positions for every board size and reports
+ * how many calls of 'EvaluateBoard()' per second the host performs on them.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/evalBench.c Core/Src/evaluation.c Core/Src/evalTables.c Core/Src/winChecks.c -o evalBench
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "gameConfiguration.h"
+#include "evaluation.h"
+#include "winChecks.h"
+
+#define positionCount 1024 /**< Number of random positions per board size */
+#define rounds 2000 /**< Number of passes over the position set */
+
+static char positions[positionCount][maxFieldSize][maxFieldSize];
+
+/**
+ * @brief Fills 'positions' with random undecided boards of the given size.
+ *
+ * @param size The size of the game board.
+ */
+static void generatePositions(int size) {
+	for (int p = 0; p < positionCount; p++) {
+		do {
+			int pieces = rand() % (size * size - 1);
+			for (int i = 0; i < maxFieldSize; i++)
+				for (int j = 0; j < maxFieldSize; j++)
+					positions[p][i][j] = '\0';
+			for (int k = 0; k < pieces; k++) {
+				int cell = rand() % (size * size);
+				positions[p][cell / size][cell % size] = k % 2 ? secondPlayerChar : firstPlayerChar;
+			}
+		} while (checkWin(positions[p], size) != '\0');
+	}
+}
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void) {
+	srand(1);
+	for (int size = 3; size <= maxFieldSize; size++) {
+		generatePositions(size);
+
+		volatile long checksum = 0;
+		double start = now();
+		for (int r = 0; r < rounds; r++) {
+			for (int p = 0; p < positionCount; p++)
+				checksum += EvaluateBoard(positions[p], size);
+		}
+		double elapsed = now() - start;
+
+		printf("%dx%d: %d windows, %.1f M evaluations/s (checksum %ld)\n", size, size,
+				evalModes[size - 3].windowCount, (double) rounds * positionCount / elapsed / 1e6, checksum);
+	}
+
+	return 0;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file genEvalTables.c
+ * @brief Host tool generating the pattern tables used by the horizon evaluation.
+ *
+ * For every board size supported by the game, the tool enumerates all winning lines ("windows") of
+ * 'toWin' consecutive cells, using the same rule for 'toWin' as 'checkWin()', and writes their cell indices
+ * to 'Core/Src/evalTables.c', together with the list of windows passing through every cell. It also writes one score table per line length, indexed by the base-3 encoding
+ * of a window's contents (0 = empty, 1 = computer, 2 = player), so the evaluation is a plain sum of
+ * table reads. The weights of the score tables come from 'evalWeights.h'. A second table with the same
+ * index marks the windows that are one piece short of a win.
+ *
+ * Build and regenerate (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/genEvalTables.c -o genEvalTables
+ *   ./genEvalTables > Core/Src/evalTables.c
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include "gameConfiguration.h"
+#include "evalWeights.h"
+
+/**
+ * @brief Score of a window holding 'count' pieces of only one player, per line length.
+ *
+ * Index [toWin][count]. The weights are tuned by 'Tools/texelTune.c', which writes 'evalWeights.h'.
+ */
+static const int lineWeights[maxFieldSize + 1][maxFieldSize + 1] = LINE_WEIGHTS;
+
+/**
+ * @brief Returns the number of consecutive pieces needed to win, as defined by 'checkWin()'.
+ *
+ * @param size The size of the game board.
+ * @return The length of a winning line.
+ */
+static int toWinFor(int size) {
+	return size > 3 ? size - 1 : 3;
+}
+
+/**
+ * @brief Writes the cell indices of all windows of one board size.
+ *
+ * @param size The size of the game board.
+ * @return The number of windows written.
+ */
+static int printWindows(int size) {
+	static const int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+	int toWin = toWinFor(size);
+	int count = 0;
+
+	printf("static const uint8_t windows%dx%d[] = {\n", size, size);
+	for (int d = 0; d < 4; d++) {
+		for (int i = 0; i < size; i++) {
+			for (int j = 0; j < size; j++) {
+				int endI = i + directions[d][0] * (toWin - 1);
+				int endJ = j + directions[d][1] * (toWin - 1);
+				if (endI < 0 || endI >= size || endJ < 0 || endJ >= size)
+					continue;
+				printf("\t");
+				for (int k = 0; k < toWin; k++) {
+					int cellI = i + directions[d][0] * k;
+					int cellJ = j + directions[d][1] * k;
+					printf("%d,%s", cellI * maxFieldSize + cellJ, k < toWin - 1 ? " " : "\n");
+				}
+				count++;
+			}
+		}
+	}
+	printf("};\n\n");
+
+	return count;
+}
+
+/**
+ * @brief Writes, for every cell of one board size, the indices of the windows passing through it.
+ *
+ * The window indices of cell c are 'cellWindows[cellWindowStart[c]]' up to, but excluding,
+ * 'cellWindows[cellWindowStart[c + 1]]'.
+ *
+ * @param size The size of the game board.
+ */
+static void printCellWindows(int size) {
+	static const int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+	int toWin = toWinFor(size);
+	int starts[maxFieldSize * maxFieldSize + 1];
+	int total = 0;
+
+	printf("static const uint8_t cellWindows%dx%d[] = {", size, size);
+	for (int cell = 0; cell < maxFieldSize * maxFieldSize; cell++) {
+		starts[cell] = total;
+		int window = 0;
+		for (int d = 0; d < 4; d++) {
+			for (int i = 0; i < size; i++) {
+				for (int j = 0; j < size; j++) {
+					int endI = i + directions[d][0] * (toWin - 1);
+					int endJ = j + directions[d][1] * (toWin - 1);
+					if (endI < 0 || endI >= size || endJ < 0 || endJ >= size)
+						continue;
+					for (int k = 0; k < toWin; k++) {
+						if ((i + directions[d][0] * k) * maxFieldSize + j + directions[d][1] * k == cell) {
+							printf("%s%d,", total % 16 == 0 ? "\n\t" : " ", window);
+							total++;
+						}
+					}
+					window++;
+				}
+			}
+		}
+	}
+	starts[maxFieldSize * maxFieldSize] = total;
+	printf("\n};\n\n");
+
+	printf("static const uint8_t cellWindowStart%dx%d[] = {", size, size);
+	for (int cell = 0; cell <= maxFieldSize * maxFieldSize; cell++)
+		printf("%s%d,", cell % 16 == 0 ? "\n\t" : " ", starts[cell]);
+	printf("\n};\n\n");
+}
+
+/**
+ * @brief Writes the score table for windows of length 'toWin'.
+ *
+ * @param toWin The length of a winning line.
+ */
+static void printScores(int toWin) {
+	int entries = 1;
+	for (int k = 0; k < toWin; k++)
+		entries *= 3;
+
+	printf("static const int16_t scores%d[%d] = {", toWin, entries);
+	for (int index = 0; index < entries; index++) {
+		int computer = 0, player = 0;
+		for (int k = 0, digits = index; k < toWin; k++, digits /= 3) {
+			computer += digits % 3 == 1;
+			player += digits % 3 == 2;
+		}
+		int score = 0;
+		if (player == 0)
+			score = lineWeights[toWin][computer];
+		else if (computer == 0)
+			score = -lineWeights[toWin][player];
+		printf("%s%d,", index % 9 == 0 ? "\n\t" : " ", score);
+	}
+	printf("\n};\n\n");
+}
+
+/**
+ * @brief Writes the threat table for windows of length 'toWin'.
+ *
+ * A window is a threat when it holds 'toWin - 1' pieces of one player and a single empty cell.
+ * The low nibble of an entry is the position of that empty cell plus one if the computer threatens,
+ * the high nibble the same for the player, and 0 means no threat.
+ *
+ * @param toWin The length of a winning line.
+ */
+static void printThreats(int toWin) {
+	int entries = 1;
+	for (int k = 0; k < toWin; k++)
+		entries *= 3;
+
+	printf("static const uint8_t threats%d[%d] = {", toWin, entries);
+	for (int index = 0; index < entries; index++) {
+		int computer = 0, player = 0, empty = 0;
+		for (int k = 0, digits = index; k < toWin; k++, digits /= 3) {
+			computer += digits % 3 == 1;
+			player += digits % 3 == 2;
+			if (digits % 3 == 0)
+				empty = k;
+		}
+		int threat = 0;
+		if (computer == toWin - 1 && player == 0)
+			threat = empty + 1;
+		else if (player == toWin - 1 && computer == 0)
+			threat = (empty + 1) << 4;
+		printf("%s0x%02X,", index % 9 == 0 ? "\n\t" : " ", threat);
+	}
+	printf("\n};\n\n");
+}
+
+int main(void) {
+	int windowCounts[maxFieldSize + 1] = { 0 };
+	bool printedScores[maxFieldSize + 1] = { false };
+
+	printf("/**\n");
+	printf(" * @file evalTables.c\n");
+	printf(" * @brief Pattern tables for the horizon evaluation.\n");
+	printf(" *\n");
+	printf(" * This file is generated by Tools/genEvalTables.c. Do not edit it by hand.\n");
+	printf(" */\n");
+	printf("#include \"evaluation.h\"\n\n");
+
+	for (int toWin = 3; toWin <= maxFieldSize; toWin++) {
+		for (int size = 3; size <= maxFieldSize; size++) {
+			if (toWinFor(size) == toWin && !printedScores[toWin]) {
+				printScores(toWin);
+				printThreats(toWin);
+				printedScores[toWin] = true;
+			}
+		}
+	}
+	for (int size = 3; size <= maxFieldSize; size++) {
+		windowCounts[size] = printWindows(size);
+		printCellWindows(size);
+	}
+
+	printf("const EvalMode evalModes[maxFieldSize - 2] = {\n");
+	for (int size = 3; size <= maxFieldSize; size++) {
+		printf("\t{ %d, %d, %d, windows%dx%d, cellWindowStart%dx%d, cellWindows%dx%d, scores%d, threats%d },\n",
+				size, toWinFor(size), windowCounts[size], size, size, size, size, size, size, toWinFor(size),
+				toWinFor(size));
+	}
+	printf("};\n");
+
+	return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file genMoveTable.c
+ * @brief Host tool generating the perfect-play move table used by the 3x3 table engine.
+ *
+ * The tool solves every 3x3 position with the computer ('o') to move by a complete negamax search,
+ * using 'checkWin()' for the game rules, and writes the best move of each position to
+ * 'Core/Src/moveTable3x3.c'. A position is indexed by the base-3 encoding of its cells, cell k
+ * (row * 3 + column) contributing 3^k times 0 (empty), 1 (computer) or 2 (player), the same digits
+ * as the evaluation tables. Like the Minimax search, the best move wins as fast as possible or loses
+ * as late as possible; among equal moves the first one in row-major order is chosen. Every position
+ * is covered, including those that cannot occur in a normal game, because the custom mode removes pieces.
+ *
+ * Build and regenerate (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/genMoveTable.c Core/Src/winChecks.c -o genMoveTable
+ *   ./genMoveTable > Core/Src/moveTable3x3.c
+ */
+#include <stdio.h>
+#include <string.h>
+#include "gameConfiguration.h"
+#include "winChecks.h"
+
+#define positionCount 19683 /**< Number of 3x3 positions, 3^9 */
+#define noMove 0xFF /**< Table entry of a position without a move */
+#define unknownScore 127 /**< Marks a position that has not been solved yet */
+
+static signed char solved[2][positionCount]; /**< Score of every position for the side to move, per side */
+
+/**
+ * @brief Computes the base-3 index of a 3x3 position.
+ *
+ * @param board The game board.
+ * @return The index of the position.
+ */
+static int positionIndex(char board[maxFieldSize][maxFieldSize]) {
+	int index = 0;
+	for (int cell = 8; cell >= 0; cell--) {
+		char piece = board[cell / 3][cell % 3];
+		index = index * 3 + (piece == secondPlayerChar) + 2 * (piece == firstPlayerChar);
+	}
+	return index;
+}
+
+/**
+ * @brief Solves a position by negamax.
+ *
+ * @param board The game board, restored before returning.
+ * @param toMove The character of the player to move.
+ * @param bestCell Receives the best cell (row * 3 + column), or 'noMove'. May be NULL.
+ * @return The score for the player to move: 1 + the number of empty cells for a win, the negative
+ *         of that for a loss, 0 for a draw.
+ */
+static int solve(char board[maxFieldSize][maxFieldSize], char toMove, int *bestCell) {
+	char status = checkWin(board, 3);
+	int empty = 0;
+	for (int cell = 0; cell < 9; cell++)
+		empty += board[cell / 3][cell % 3] == '\0';
+	if (bestCell != NULL)
+		*bestCell = noMove;
+	if (status == 'd')
+		return 0;
+	if (status != '\0')
+		return status == toMove ? 1 + empty : -(1 + empty);
+
+	int side = toMove == secondPlayerChar;
+	int index = positionIndex(board);
+	if (bestCell == NULL && solved[side][index] != unknownScore)
+		return solved[side][index];
+
+	char opponent = toMove == secondPlayerChar ? firstPlayerChar : secondPlayerChar;
+	int bestScore = -100;
+	for (int cell = 0; cell < 9; cell++) {
+		if (board[cell / 3][cell % 3] != '\0')
+			continue;
+		board[cell / 3][cell % 3] = toMove;
+		int score = -solve(board, opponent, NULL);
+		board[cell / 3][cell % 3] = '\0';
+		if (score > bestScore) {
+			bestScore = score;
+			if (bestCell != NULL)
+				*bestCell = cell;
+		}
+	}
+
+	solved[side][index] = bestScore;
+	return bestScore;
+}
+
+int main(void) {
+	memset(solved, unknownScore, sizeof(solved));
+
+	printf("/**\n");
+	printf(" * @file moveTable3x3.c\n");
+	printf(" * @brief Perfect-play move table of the 3x3 table engine.\n");
+	printf(" *\n");
+	printf(" * This file is generated by Tools/genMoveTable.c. Do not edit it by hand.\n");
+	printf(" */\n");
+	printf("#include <stdint.h>\n\n");
+	printf("const uint8_t moveTable3x3[%d] = {", positionCount);
+
+	for (int index = 0; index < positionCount; index++) {
+		char board[maxFieldSize][maxFieldSize] = { { 0 } };
+		for (int cell = 0, digits = index; cell < 9; cell++, digits /= 3)
+			board[cell / 3][cell % 3] = digits % 3 == 1 ? secondPlayerChar : (digits % 3 == 2 ? firstPlayerChar : '\0');
+
+		int bestCell;
+		solve(board, secondPlayerChar, &bestCell);
+		printf("%s%d,", index % 24 == 0 ? "\n\t" : " ", bestCell);
+	}
+	printf("\n};\n");
+
+	return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file genPageFonts.c
+ * @brief Host tool converting the fonts of the display driver to the display's page format.
+ *
+ * The fonts in 'Core/Src/ssd1306_fonts.c' store a glyph as one 16-bit word per pixel row, the leftmost
+ * pixel in the highest bit. The SSD1306 stores a byte per column and page of 8 rows, the top row in the
+ * lowest bit, so the tool transposes every glyph into 'width' bytes per page: a glyph of 'height' rows
+ * takes 'width * ((height + 7) / 8)' bytes, page after page. 'ssd1306_WriteChar()' then writes whole
+ * bytes, shifted to the cursor's row, instead of every pixel. The rows below the glyph in its last page
+ * are 0.
+ *
+ * The tool writes 'Core/Src/ssd1306_page_fonts.c', which 'ssd1306_fonts.c' links to the fonts. The tool
+ * reads the row tables through the driver's fonts, built with SSD1306_ROW_FONTS_ONLY so that it does not
+ * link the file it writes, and with the mock HAL.
+ *
+ * Build and regenerate (from the repository root):
+ *   gcc -O2 -DSSD1306_ROW_FONTS_ONLY -ITools/mockHal -ICore/Inc Tools/genPageFonts.c \
+ *       Core/Src/ssd1306_fonts.c -o genPageFonts
+ *   ./genPageFonts > Core/Src/ssd1306_page_fonts.c
+ */
+#include <stdio.h>
+#include "ssd1306_fonts.h"
+
+/**
+ * @brief A font to convert.
+ */
+typedef struct {
+	const SSD1306_Font_t *font;
+	const char *table; /**< Name of the generated table */
+	const char *option; /**< Option of 'ssd1306_conf.h' including the font */
+} PageFont;
+
+/**
+ * @brief The converted fonts: those the game draws with.
+ */
+static const PageFont pageFonts[] = {
+	{ &Font_6x8, "Font6x8Pages", "SSD1306_INCLUDE_FONT_6x8" },
+	{ &Font_7x10, "Font7x10Pages", "SSD1306_INCLUDE_FONT_7x10" },
+};
+
+/**
+ * @brief Writes the glyphs of a font in page format.
+ *
+ * @param pageFont The font.
+ */
+static void printFont(const PageFont *pageFont) {
+	const SSD1306_Font_t *font = pageFont->font;
+	int pages = (font->height + 7) / 8;
+
+	printf("#ifdef %s\n", pageFont->option);
+	printf("const uint8_t %s[] = {\n", pageFont->table);
+	for (int ch = 32; ch <= 126; ch++) {
+		const uint16_t *rows = &font->data[(ch - 32) * font->height];
+		for (int page = 0; page < pages; page++) {
+			for (int x = 0; x < font->width; x++) {
+				int column = 0;
+				for (int bit = 0; bit < 8 && page * 8 + bit < font->height; bit++) {
+					if (rows[page * 8 + bit] & (0x8000 >> x))
+						column |= 1 << bit;
+				}
+				printf("0x%02X, ", column);
+			}
+		}
+		if (ch == ' ')
+			printf(" // sp\n");
+		else if (ch == '\\')
+			printf(" /* \\ */\n");
+		else
+			printf(" // %c\n", ch);
+	}
+	printf("};\n");
+	printf("#endif\n\n");
+}
+
+int main(void) {
+	printf("/**\n");
+	printf(" * Glyphs of the fonts in display page format: 'width' bytes per page of 8 rows,\n");
+	printf(" * the top row in the lowest bit, 'width * ((height + 7) / 8)' bytes per glyph.\n");
+	printf(" *\n");
+	printf(" * This file is generated by Tools/genPageFonts.c from ssd1306_fonts.c. Do not edit it by hand.\n");
+	printf(" */\n");
+	printf("#include \"ssd1306_fonts.h\"\n\n");
+	for (size_t i = 0; i < sizeof(pageFonts) / sizeof(pageFonts[0]); i++)
+		printFont(&pageFonts[i]);
+	return 0;
+}
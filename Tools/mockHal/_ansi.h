@@ -0,0 +1,17 @@
+/**
+ * @file _ansi.h
+ * @brief Stand-in for the newlib header used by 'ssd1306.h', for host builds with the mock HAL.
+ */
+#pragma once
+#ifndef TOOLS_MOCKHAL_ANSI_H_
+#define TOOLS_MOCKHAL_ANSI_H_
+
+#ifdef __cplusplus
+#define _BEGIN_STD_C extern "C" {
+#define _END_STD_C }
+#else
+#define _BEGIN_STD_C
+#define _END_STD_C
+#endif
+
+#endif /* TOOLS_MOCKHAL_ANSI_H_ */
@@ -0,0 +1,291 @@
+/**
+ * @file mockHal.c
+ * @brief Host mock of the HAL I2C, SPI and GPIO functions, feeding an emulated SSD1306 controller.
+ */
+#include <string.h>
+#include "stm32l4xx_hal.h"
+
+/**
+ * @brief State of the emulated controller.
+ */
+typedef struct {
+	uint8_t ram[mockDisplayPages][mockDisplayWidth];
+	uint8_t addressingMode; /**< 0: horizontal, 1: vertical, 2: page, as set by command 0x20 */
+	bool isInverted; /**< Colors inverted by command 0xA7, normal after 0xA6 */
+	uint8_t column, page; /**< Address pointer */
+	uint8_t columnStart, columnEnd; /**< Column window of the horizontal and vertical modes */
+	uint8_t pageStart, pageEnd; /**< Page window of the horizontal and vertical modes */
+	uint8_t command; /**< Command whose arguments are being received */
+	uint8_t arguments[6];
+	uint8_t argumentCount, argumentsNeeded;
+} Controller;
+
+/**
+ * @brief A DMA transfer waiting for 'MockDmaComplete()'.
+ */
+typedef struct {
+	bool isPending;
+	I2C_HandleTypeDef *hi2c; /**< NULL for an SPI transfer */
+	SPI_HandleTypeDef *hspi; /**< NULL for an I2C transfer */
+	uint16_t control; /**< I2C control byte */
+	uint8_t *data;
+	uint16_t size;
+} Transfer;
+
+/**
+ * @brief The SPI pins of the controller.
+ */
+typedef struct {
+	GPIO_TypeDef *csPort, *dcPort;
+	uint16_t csPin, dcPin;
+} SpiPins;
+
+GPIO_TypeDef mockGpioA, mockGpioB, mockGpioC;
+uint32_t mockPrimask;
+
+static Controller controller;
+static Transfer transfer;
+static SpiPins spiPins;
+static MockBusCounts counts;
+
+/**
+ * @brief Returns the number of argument bytes of a command.
+ */
+static uint8_t argumentsOf(uint8_t command) {
+	switch (command) {
+	case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+		return 1;
+	case 0x21: case 0x22: case 0xA3:
+		return 2;
+	case 0x29: case 0x2A:
+		return 5;
+	case 0x26: case 0x27:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Executes a command once all its arguments have arrived.
+ */
+static void execute(uint8_t command, const uint8_t *arguments) {
+	if (command == 0x20) {
+		controller.addressingMode = arguments[0] & 0x03;
+	} else if (command == 0x21) {
+		controller.columnStart = controller.column = arguments[0] % mockDisplayWidth;
+		controller.columnEnd = arguments[1] % mockDisplayWidth;
+	} else if (command == 0x22) {
+		controller.pageStart = controller.page = arguments[0] % mockDisplayPages;
+		controller.pageEnd = arguments[1] % mockDisplayPages;
+	} else if (command == 0xA6 || command == 0xA7) {
+		controller.isInverted = command == 0xA7;
+	} else if (command >= 0xB0 && command <= 0xB7) {
+		controller.page = (command & 0x07) % mockDisplayPages;
+	} else if (command <= 0x0F) {
+		controller.column = (controller.column & 0xF0) | command;
+	} else if (command <= 0x1F) {
+		controller.column = ((controller.column & 0x0F) | (command & 0x07) << 4) % mockDisplayWidth;
+	}
+}
+
+/**
+ * @brief Receives a command byte.
+ */
+static void receiveCommand(uint8_t byte) {
+	if (controller.argumentCount < controller.argumentsNeeded) {
+		controller.arguments[controller.argumentCount++] = byte;
+		if (controller.argumentCount == controller.argumentsNeeded)
+			execute(controller.command, controller.arguments);
+		return;
+	}
+	controller.command = byte;
+	controller.argumentCount = 0;
+	controller.argumentsNeeded = argumentsOf(byte);
+	if (controller.argumentsNeeded == 0)
+		execute(byte, NULL);
+}
+
+/**
+ * @brief Receives a data byte and advances the address pointer as the addressing mode says.
+ */
+static void receiveData(uint8_t byte) {
+	controller.ram[controller.page][controller.column] = byte;
+	if (controller.addressingMode == 2) {
+		controller.column = (controller.column + 1) % mockDisplayWidth;
+	} else if (controller.addressingMode == 0) {
+		if (controller.column++ == controller.columnEnd) {
+			controller.column = controller.columnStart;
+			controller.page = controller.page == controller.pageEnd ? controller.pageStart : controller.page + 1;
+		}
+	} else {
+		if (controller.page++ == controller.pageEnd) {
+			controller.page = controller.pageStart;
+			controller.column = controller.column == controller.columnEnd ? controller.columnStart : controller.column + 1;
+		}
+	}
+}
+
+/**
+ * @brief Sends one I2C transaction to the controller.
+ *
+ * @param control The control byte: 0x00 for commands, 0x40 for data.
+ * @param data The bytes after the control byte.
+ * @param size The number of bytes.
+ */
+static void sendTransaction(uint16_t control, const uint8_t *data, uint16_t size) {
+	counts.transactions++;
+	counts.bytes += 2 + size;
+	for (uint16_t i = 0; i < size; i++) {
+		if (control == 0x40)
+			receiveData(data[i]);
+		else
+			receiveCommand(data[i]);
+	}
+}
+
+/**
+ * @brief Sends bytes on SPI: the controller takes them while it is selected, as commands or data by DC.
+ *
+ * @param data The bytes.
+ * @param size The number of bytes.
+ */
+static void sendSpi(const uint8_t *data, uint16_t size) {
+	counts.transactions++;
+	counts.bytes += size;
+	if (spiPins.csPort == NULL || (spiPins.csPort->output & spiPins.csPin))
+		return;
+	bool isData = (spiPins.dcPort->output & spiPins.dcPin) != 0;
+	for (uint16_t i = 0; i < size; i++) {
+		if (isData)
+			receiveData(data[i]);
+		else
+			receiveCommand(data[i]);
+	}
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+	(void) hi2c;
+	(void) DevAddress;
+	(void) MemAddSize;
+	(void) Timeout;
+	if (transfer.isPending)
+		return HAL_BUSY;
+	sendTransaction(MemAddress, pData, Size);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+	(void) DevAddress;
+	(void) MemAddSize;
+	if (transfer.isPending)
+		return HAL_BUSY;
+	if (pData == NULL || Size == 0)
+		return HAL_ERROR;
+	transfer = (Transfer) { true, hi2c, NULL, MemAddress, pData, Size };
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+	(void) hspi;
+	(void) Timeout;
+	if (transfer.isPending)
+		return HAL_BUSY;
+	sendSpi(pData, Size);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) {
+	if (transfer.isPending)
+		return HAL_BUSY;
+	if (pData == NULL || Size == 0)
+		return HAL_ERROR;
+	transfer = (Transfer) { true, NULL, hspi, 0, pData, Size };
+	return HAL_OK;
+}
+
+__weak void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+	(void) hspi;
+}
+
+__weak void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+	(void) hspi;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+	uint16_t output = PinState == GPIO_PIN_SET ? GPIOx->output | GPIO_Pin : GPIOx->output & ~GPIO_Pin;
+	if (GPIOx == spiPins.dcPort && (GPIO_Pin & spiPins.dcPin) && ((output ^ GPIOx->output) & spiPins.dcPin))
+		counts.dcChanges++;
+	GPIOx->output = output;
+}
+
+__weak void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+	(void) hi2c;
+}
+
+__weak void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+	(void) hi2c;
+}
+
+void HAL_Delay(uint32_t Delay) {
+	(void) Delay;
+}
+
+void MockReset(void) {
+	memset(&controller, 0, sizeof(controller));
+	memset(controller.ram, 0xA5, sizeof(controller.ram));
+	controller.addressingMode = 2;
+	controller.columnEnd = mockDisplayWidth - 1;
+	controller.pageEnd = mockDisplayPages - 1;
+	transfer.isPending = false;
+	MockClearCounts();
+}
+
+const uint8_t* MockDisplayRam(void) {
+	return &controller.ram[0][0];
+}
+
+bool MockDisplayInverted(void) {
+	return controller.isInverted;
+}
+
+void MockSpiPins(GPIO_TypeDef *csPort, uint16_t csPin, GPIO_TypeDef *dcPort, uint16_t dcPin) {
+	spiPins = (SpiPins) { csPort, dcPort, csPin, dcPin };
+}
+
+MockBusCounts MockGetCounts(void) {
+	return counts;
+}
+
+void MockClearCounts(void) {
+	counts = (MockBusCounts) { 0 };
+}
+
+bool MockDmaPending(void) {
+	return transfer.isPending;
+}
+
+void MockDmaComplete(void) {
+	if (!transfer.isPending)
+		return;
+	transfer.isPending = false;
+	if (transfer.hspi != NULL) {
+		sendSpi(transfer.data, transfer.size);
+		HAL_SPI_TxCpltCallback(transfer.hspi);
+	} else {
+		sendTransaction(transfer.control, transfer.data, transfer.size);
+		HAL_I2C_MemTxCpltCallback(transfer.hi2c);
+	}
+}
+
+void MockDmaFail(void) {
+	if (!transfer.isPending)
+		return;
+	transfer.isPending = false;
+	if (transfer.hspi != NULL)
+		HAL_SPI_ErrorCallback(transfer.hspi);
+	else
+		HAL_I2C_ErrorCallback(transfer.hi2c);
+}
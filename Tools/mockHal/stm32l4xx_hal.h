@@ -0,0 +1,160 @@
+/**
+ * @file stm32l4xx_hal.h
+ * @brief Host mock of the parts of the STM32 HAL used by the display driver, with an emulated SSD1306.
+ *
+ * Putting 'Tools/mockHal' first on the include path makes 'Core/Src/ssd1306.c' build on the host. The
+ * I2C and SPI functions feed an emulation of the SSD1306 controller: commands change its address pointers
+ * and data is written to its display RAM, following the horizontal and page addressing modes. On SPI, the
+ * controller only receives while its CS pin is low, and its DC pin tells commands from data when the bytes
+ * arrive; the tool names the pins with 'MockSpiPins()'. Blocking
+ * transfers complete at once. A DMA transfer stays pending until 'MockDmaComplete()' or 'MockDmaFail()'
+ * is called, which also run the HAL callbacks, as the interrupts would; the data is read when the
+ * transfer completes, so changes to the buffer made meanwhile reach the display, like a real DMA reading
+ * the buffer during the transfer. The mock also counts the transactions and bytes sent on the bus.
+ *
+ * Add 'Tools/mockHal/mockHal.c' to the build of a tool.
+ */
+#pragma once
+#ifndef TOOLS_MOCKHAL_STM32L4XX_HAL_H_
+#define TOOLS_MOCKHAL_STM32L4XX_HAL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define __weak __attribute__((weak))
+#define HAL_MAX_DELAY 0xFFFFFFFFU
+
+#define mockDisplayWidth 128 /**< Columns of the emulated display RAM */
+#define mockDisplayPages 8 /**< Pages of the emulated display RAM */
+
+typedef enum {
+	HAL_OK = 0x00, HAL_ERROR = 0x01, HAL_BUSY = 0x02, HAL_TIMEOUT = 0x03
+} HAL_StatusTypeDef;
+
+typedef struct {
+	int unused;
+} I2C_HandleTypeDef;
+
+typedef struct {
+	int unused;
+} SPI_HandleTypeDef;
+
+typedef struct {
+	uint16_t output; /**< Levels written by 'HAL_GPIO_WritePin()', one bit per pin */
+} GPIO_TypeDef;
+
+typedef enum {
+	GPIO_PIN_RESET = 0, GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef mockGpioA, mockGpioB, mockGpioC;
+#define GPIOA (&mockGpioA)
+#define GPIOB (&mockGpioB)
+#define GPIOC (&mockGpioC)
+
+#define GPIO_PIN_0 ((uint16_t) 0x0001)
+#define GPIO_PIN_1 ((uint16_t) 0x0002)
+#define GPIO_PIN_2 ((uint16_t) 0x0004)
+#define GPIO_PIN_3 ((uint16_t) 0x0008)
+#define GPIO_PIN_4 ((uint16_t) 0x0010)
+#define GPIO_PIN_5 ((uint16_t) 0x0020)
+#define GPIO_PIN_6 ((uint16_t) 0x0040)
+#define GPIO_PIN_7 ((uint16_t) 0x0080)
+#define GPIO_PIN_8 ((uint16_t) 0x0100)
+#define GPIO_PIN_9 ((uint16_t) 0x0200)
+#define GPIO_PIN_10 ((uint16_t) 0x0400)
+#define GPIO_PIN_11 ((uint16_t) 0x0800)
+#define GPIO_PIN_12 ((uint16_t) 0x1000)
+#define GPIO_PIN_13 ((uint16_t) 0x2000)
+#define GPIO_PIN_14 ((uint16_t) 0x4000)
+#define GPIO_PIN_15 ((uint16_t) 0x8000)
+
+/**
+ * @brief Bus traffic counted by the mock.
+ */
+typedef struct {
+	unsigned long transactions; /**< Number of I2C transactions (start to stop) or SPI transfers */
+	unsigned long bytes; /**< Bytes on the bus, including the I2C address and control bytes */
+	unsigned long dcChanges; /**< Number of changes of the SPI DC pin */
+} MockBusCounts;
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+
+/**
+ * @brief CMSIS interrupt masking. The host runs no interrupts, so the mask is only stored.
+ */
+extern uint32_t mockPrimask;
+static inline uint32_t __get_PRIMASK(void) {
+	return mockPrimask;
+}
+static inline void __set_PRIMASK(uint32_t priMask) {
+	mockPrimask = priMask;
+}
+static inline void __disable_irq(void) {
+	mockPrimask = 1;
+}
+
+/**
+ * @brief Fills the emulated display RAM with a pattern, drops a pending transfer and clears the counts.
+ */
+void MockReset(void);
+
+/**
+ * @brief Names the pins of the emulated controller on SPI.
+ *
+ * @param csPort The port of the chip select pin, active low.
+ * @param csPin The chip select pin.
+ * @param dcPort The port of the data/command pin, high for data.
+ * @param dcPin The data/command pin.
+ */
+void MockSpiPins(GPIO_TypeDef *csPort, uint16_t csPin, GPIO_TypeDef *dcPort, uint16_t dcPin);
+
+/**
+ * @brief Returns the emulated display RAM, 'mockDisplayPages' rows of 'mockDisplayWidth' bytes.
+ */
+const uint8_t* MockDisplayRam(void);
+
+/**
+ * @brief Returns true if the emulated display shows its RAM with inverted colors.
+ */
+bool MockDisplayInverted(void);
+
+/**
+ * @brief Returns the bus traffic since the last call of 'MockReset()' or 'MockClearCounts()'.
+ */
+MockBusCounts MockGetCounts(void);
+
+/**
+ * @brief Clears the bus traffic counts.
+ */
+void MockClearCounts(void);
+
+/**
+ * @brief Returns true if a DMA transfer is waiting for 'MockDmaComplete()'.
+ */
+bool MockDmaPending(void);
+
+/**
+ * @brief Completes the pending DMA transfer and calls 'HAL_I2C_MemTxCpltCallback()' or
+ *        'HAL_SPI_TxCpltCallback()'.
+ */
+void MockDmaComplete(void);
+
+/**
+ * @brief Drops the pending DMA transfer and calls 'HAL_I2C_ErrorCallback()' or 'HAL_SPI_ErrorCallback()'.
+ */
+void MockDmaFail(void);
+
+#endif /* TOOLS_MOCKHAL_STM32L4XX_HAL_H_ */
@@ -0,0 +1,228 @@
+/**
+ * @file perft.c
+ * @brief Host tool counting the game tree from the empty board (perft) to verify move generation and win checks.
+ *
+ * For a board size and a depth, the tool plays every sequence of moves from the empty board, the first
+ * player ('x') moving first, with the moves from 'GetAvailableMoves()' and the game ending as decided by
+ * 'checkWin()'. For every ply it counts the positions reached and the games that end there with a win of
+ * either side or a draw. Decided games are not continued. The counts are compared with the reference
+ * counts below, so any change to the move generation or the win checks that changes the rules shows up
+ * as a mismatch. The 3x3 reference is the complete game tree of tic-tac-toe (255168 games, 131184 won
+ * by the first player, 77904 by the second, 46080 drawn). The 4x4 and 5x5 references stop where the
+ * tree gets too large to count in seconds; on 5x5 the first win needs seven plies, so its reference
+ * only covers the move generation. The tool also reports the node rate, as a throughput benchmark of
+ * the move generation and win checks.
+ *
+ * With -s, the cell-by-cell 'checkWinScalar()' is used instead of 'checkWin()'. With -c, every
+ * position is checked with both, and with 'isDraw()', and the tool stops at the first disagreement.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/perft.c Core/Src/minimax.c Core/Src/proofNumber.c Core/Src/evaluation.c \
+ *       Core/Src/evalTables.c Core/Src/winChecks.c -o perft
+ *
+ * Usage:
+ *   ./perft [-s | -c] [size] [depth]
+ *   Without a size, every reference is checked.
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gameConfiguration.h"
+#include "minimax.h"
+#include "winChecks.h"
+
+#define maxPlies (maxFieldSize * maxFieldSize) /**< Largest number of plies of a game */
+
+/**
+ * @brief Counts of one ply of the game tree.
+ */
+typedef struct {
+	unsigned long long positions; /**< Positions reached after this ply */
+	unsigned long long firstWins; /**< Games won by the first player with this ply */
+	unsigned long long secondWins; /**< Games won by the second player with this ply */
+	unsigned long long draws; /**< Games drawn with this ply */
+} PerftCounts;
+
+/**
+ * @brief Reference counts of one ply of the game tree of a board size.
+ */
+typedef struct {
+	int size;
+	int ply;
+	PerftCounts counts;
+} PerftReference;
+
+/**
+ * @brief The reference counts. Every size is listed up to the depth checked by default.
+ */
+static const PerftReference references[] = {
+	{ 3, 1, { 9, 0, 0, 0 } },
+	{ 3, 2, { 72, 0, 0, 0 } },
+	{ 3, 3, { 504, 0, 0, 0 } },
+	{ 3, 4, { 3024, 0, 0, 0 } },
+	{ 3, 5, { 15120, 1440, 0, 0 } },
+	{ 3, 6, { 54720, 0, 5328, 0 } },
+	{ 3, 7, { 148176, 47952, 0, 0 } },
+	{ 3, 8, { 200448, 0, 72576, 0 } },
+	{ 3, 9, { 127872, 81792, 0, 46080 } },
+	{ 4, 1, { 16, 0, 0, 0 } },
+	{ 4, 2, { 240, 0, 0, 0 } },
+	{ 4, 3, { 3360, 0, 0, 0 } },
+	{ 4, 4, { 43680, 0, 0, 0 } },
+	{ 4, 5, { 524160, 22464, 0, 0 } },
+	{ 4, 6, { 5518656, 0, 236880, 0 } },
+	{ 4, 7, { 52817760, 6803424, 0, 0 } },
+	{ 5, 1, { 25, 0, 0, 0 } },
+	{ 5, 2, { 600, 0, 0, 0 } },
+	{ 5, 3, { 13800, 0, 0, 0 } },
+	{ 5, 4, { 303600, 0, 0, 0 } },
+	{ 5, 5, { 6375600, 0, 0, 0 } },
+	{ 5, 6, { 127512000, 0, 0, 0 } },
+};
+
+#define referenceCount ((int) (sizeof(references) / sizeof(references[0]))) /**< Number of reference entries */
+
+static char (*check)(char[maxFieldSize][maxFieldSize], int) = checkWin; /**< The win check being counted */
+static bool isCrossChecked; /**< True if every position is checked by all win checks */
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Checks a position with every win check and stops the tool if they disagree.
+ *
+ * @param board The game board.
+ * @param size The size of the game board.
+ * @param status The result of 'checkWin()'.
+ */
+static void crossCheck(char board[maxFieldSize][maxFieldSize], int size, char status) {
+	char scalar = checkWinScalar(board, size);
+	bool isFull = isDraw(board, size);
+	if (status == scalar && (status != 'd' || isFull) && (status != '\0' || !isFull))
+		return;
+
+	fprintf(stderr, "win checks disagree on %dx%d: checkWin '%c', checkWinScalar '%c', isDraw %d\n", size, size,
+			status ? status : '-', scalar ? scalar : '-', isFull);
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++)
+			fputc(board[i][j] ? board[i][j] : '.', stderr);
+		fputc('\n', stderr);
+	}
+	exit(1);
+}
+
+/**
+ * @brief Counts the game tree below a position.
+ *
+ * @param board The game board, restored before returning.
+ * @param size The size of the game board.
+ * @param ply The number of plies played so far.
+ * @param depth The last ply to count.
+ * @param counts The counts per ply, indexed by the ply.
+ */
+static void perft(char board[maxFieldSize][maxFieldSize], int size, int ply, int depth, PerftCounts counts[]) {
+	int moves[maxFieldSize * maxFieldSize][2], moveCount;
+	char player = ply % 2 ? secondPlayerChar : firstPlayerChar;
+	PerftCounts *next = &counts[ply + 1];
+	GetAvailableMoves(board, size, moves, &moveCount);
+
+	for (int i = 0; i < moveCount; i++) {
+		int x = moves[i][0], y = moves[i][1];
+		board[x][y] = player;
+		char status = check(board, size);
+		if (isCrossChecked)
+			crossCheck(board, size, status);
+
+		next->positions++;
+		if (status == firstPlayerChar)
+			next->firstWins++;
+		else if (status == secondPlayerChar)
+			next->secondWins++;
+		else if (status == 'd')
+			next->draws++;
+		else if (ply + 1 < depth)
+			perft(board, size, ply + 1, depth, counts);
+		board[x][y] = '\0';
+	}
+}
+
+/**
+ * @brief Counts the game tree of a board size and compares it with the reference counts.
+ *
+ * @param size The size of the game board.
+ * @param depth The last ply to count.
+ * @return The number of plies whose counts differ from the reference.
+ */
+static int runPerft(int size, int depth) {
+	char board[maxFieldSize][maxFieldSize] = { { 0 } };
+	PerftCounts counts[maxPlies + 1];
+	memset(counts, 0, sizeof(counts));
+
+	double start = now();
+	perft(board, size, 0, depth, counts);
+	double elapsed = now() - start;
+
+	int mismatches = 0;
+	unsigned long long total = 0;
+	printf("%dx%d to depth %d\n%4s %14s %12s %12s %12s  %s\n", size, size, depth, "ply", "positions", "x wins",
+			"o wins", "draws", "reference");
+	for (int ply = 1; ply <= depth; ply++) {
+		const PerftCounts *c = &counts[ply];
+		const char *verdict = "none";
+		for (int r = 0; r < referenceCount; r++) {
+			if (references[r].size != size || references[r].ply != ply)
+				continue;
+			bool isEqual = memcmp(&references[r].counts, c, sizeof(*c)) == 0;
+			verdict = isEqual ? "ok" : "MISMATCH";
+			mismatches += !isEqual;
+		}
+		printf("%4d %14llu %12llu %12llu %12llu  %s\n", ply, c->positions, c->firstWins, c->secondWins, c->draws,
+				verdict);
+		total += c->positions;
+	}
+	printf("%llu positions in %.3f s, %.1f M positions/s\n\n", total, elapsed, total / elapsed * 1e-6);
+
+	return mismatches;
+}
+
+int main(int argc, char **argv) {
+	int argi = 1;
+	if (argi < argc && strcmp(argv[argi], "-s") == 0) {
+		check = checkWinScalar;
+		argi++;
+	} else if (argi < argc && strcmp(argv[argi], "-c") == 0) {
+		isCrossChecked = true;
+		argi++;
+	}
+
+	int mismatches = 0;
+	if (argi < argc) {
+		int size = atoi(argv[argi]);
+		int depth = argi + 1 < argc ? atoi(argv[argi + 1]) : size * size;
+		if (size < 3 || size > maxFieldSize || depth < 1 || depth > size * size) {
+			fprintf(stderr, "usage: %s [-s | -c] [size] [depth]\n", argv[0]);
+			return 2;
+		}
+		mismatches = runPerft(size, depth);
+	} else {
+		for (int size = 3; size <= maxFieldSize; size++) {
+			int depth = 0;
+			for (int r = 0; r < referenceCount; r++)
+				depth = references[r].size == size && references[r].ply > depth ? references[r].ply : depth;
+			if (depth > 0)
+				mismatches += runPerft(size, depth);
+		}
+	}
+
+	if (mismatches > 0)
+		printf("%d plies differ from the reference counts\n", mismatches);
+	return mismatches > 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file pnSolve.c
+ * @brief Host tool for analysing positions with the proof-number search.
+ *
+ * The tool runs the same proof-number search that the firmware uses on the computer's turn and prints
+ * whether the position is a proven win, loss or draw for the side to move, together with the first move
+ * and length of the fastest proven win.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/pnSolve.c Core/Src/proofNumber.c Core/Src/winChecks.c -o pnSolve
+ *
+ * Usage:
+ *   ./pnSolve <size> <cells> [toMove]
+ *   <cells> lists the board row by row using 'x', 'o' and '.' for an empty cell, e.g. "x...o....".
+ *   [toMove] is 'x' or 'o'; by default the player with fewer pieces moves, 'x' on a tie.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "gameConfiguration.h"
+#include "proofNumber.h"
+
+int main(int argc, char **argv) {
+	char board[maxFieldSize][maxFieldSize] = { { 0 } };
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <size> <cells> [toMove]\n", argv[0]);
+		return 2;
+	}
+
+	int size = argv[1][0] - '0';
+	if (size < 3 || size > maxFieldSize || (int) strlen(argv[2]) != size * size) {
+		fprintf(stderr, "expected a board size of 3..%d and %d cells\n", maxFieldSize, size * size);
+		return 2;
+	}
+
+	int xCount = 0, oCount = 0;
+	for (int i = 0; i < size * size; i++) {
+		char cell = argv[2][i];
+		board[i / size][i % size] = cell == firstPlayerChar || cell == secondPlayerChar ? cell : '\0';
+		xCount += cell == firstPlayerChar;
+		oCount += cell == secondPlayerChar;
+	}
+	char toMove = argc > 3 ? argv[3][0] : (oCount < xCount ? secondPlayerChar : firstPlayerChar);
+
+	int x, y;
+	PnResult result = ProofNumberSolve(board, size, toMove, &x, &y);
+	switch (result) {
+	case pnProvenWin:
+		printf("win for %c in %d plies, play row %d column %d\n", toMove, ProofNumberWinDepth(), x, y);
+		break;
+	case pnProvenLoss:
+		printf("loss for %c in %d plies\n", toMove, ProofNumberWinDepth());
+		break;
+	case pnProvenDraw:
+		printf("draw\n");
+		break;
+	case pnUnknown:
+		printf("unknown within %d nodes\n", PN_NODE_POOL_SIZE);
+		break;
+	}
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file searchBench.c
+ * @brief Host benchmark of the Minimax search on a fixed set of positions.
+ *
+ * For the 4x4 and 5x5 boards, the benchmark generates a fixed set of random, undecided positions with
+ * the computer to move in which some, but not all, moves lose by force, as proven by the proof-number
+ * search. For every position it lets 'ComputerMove()' choose a move and reports the average number of
+ * search nodes and the time per move, and how often the chosen move does not lose. The first figures
+ * measure the cost of the search, the last one catches playing-strength regressions of the pruning.
+ *
+ * The search constants in 'minimax.h' can be overridden on the command line to compare settings.
+ * The larger proof-number pool is needed to prove the losing moves; it also applies to 'ComputerMove()'.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc -DPN_NODE_POOL_SIZE=4000 Tools/searchBench.c Core/Src/minimax.c Core/Src/proofNumber.c \
+ *       Core/Src/evaluation.c Core/Src/evalTables.c Core/Src/winChecks.c -o searchBench
+ *
+ * Usage:
+ *   ./searchBench [positions]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gameConfiguration.h"
+#include "minimax.h"
+#include "proofNumber.h"
+#include "winChecks.h"
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Generates the next benchmark position.
+ *
+ * The position has the same number of pieces for both players, so the computer is to move. It is kept
+ * only if the computer has no proven win, which 'ComputerMove()' would play without searching, and if
+ * at least one move, but not every move, gives the player a proven win.
+ *
+ * @param board Receives the position.
+ * @param size The size of the game board.
+ * @param losing Receives, for every cell, whether moving there loses.
+ */
+static void nextPosition(char board[maxFieldSize][maxFieldSize], int size,
+		bool losing[maxFieldSize][maxFieldSize]) {
+	for (;;) {
+		memset(board, 0, maxFieldSize * maxFieldSize);
+		int pieces = 2 * (2 + rand() % 5);
+		for (int k = 0; k < pieces;) {
+			int cell = rand() % (size * size);
+			if (board[cell / size][cell % size] != '\0')
+				continue;
+			board[cell / size][cell % size] = k % 2 ? secondPlayerChar : firstPlayerChar;
+			k++;
+		}
+
+		int x, y;
+		if (checkWin(board, size) != '\0' || ProofNumberSolve(board, size, secondPlayerChar, &x, &y) == pnProvenWin)
+			continue;
+
+		int losingCount = 0, safeCount = 0;
+		for (int i = 0; i < size; i++) {
+			for (int j = 0; j < size; j++) {
+				losing[i][j] = false;
+				if (board[i][j] != '\0')
+					continue;
+				board[i][j] = secondPlayerChar;
+				losing[i][j] = ProofNumberSolve(board, size, firstPlayerChar, &x, &y) == pnProvenWin;
+				board[i][j] = '\0';
+				losingCount += losing[i][j];
+				safeCount += !losing[i][j];
+			}
+		}
+		if (losingCount > 0 && safeCount > 0)
+			return;
+	}
+}
+
+int main(int argc, char **argv) {
+	int positionCount = argc > 1 ? atoi(argv[1]) : 100;
+
+	printf("LATE_MOVE_INDEX %d, LATE_MOVE_REDUCTION %d, FUTILITY_MARGIN %d, EXTENSION_BUDGET %d\n",
+			LATE_MOVE_INDEX, LATE_MOVE_REDUCTION, FUTILITY_MARGIN, EXTENSION_BUDGET);
+
+	for (int size = 4; size <= maxFieldSize; size++) {
+		srand(size);
+		unsigned long nodes = 0;
+		double elapsed = 0;
+		int safeMoves = 0;
+
+		for (int p = 0; p < positionCount; p++) {
+			char board[maxFieldSize][maxFieldSize], before[maxFieldSize][maxFieldSize];
+			bool losing[maxFieldSize][maxFieldSize];
+			nextPosition(board, size, losing);
+			memcpy(before, board, sizeof(before));
+
+			double start = now();
+			ComputerMove(board, size);
+			elapsed += now() - start;
+			nodes += MinimaxNodeCount();
+
+			for (int i = 0; i < size; i++) {
+				for (int j = 0; j < size; j++) {
+					if (board[i][j] != before[i][j])
+						safeMoves += !losing[i][j];
+				}
+			}
+		}
+
+		printf("%dx%d: %d positions, %lu nodes/move, %.2f ms/move, %d non-losing moves\n", size, size,
+				positionCount, nodes / positionCount, elapsed * 1e3 / positionCount, safeMoves);
+	}
+
+	return 0;
+}
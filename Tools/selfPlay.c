@@ -0,0 +1,334 @@
+/**
+ * @file selfPlay.c
+ * @brief Host tool generating labelled positions for 'Tools/texelTune.c' by letting an engine play itself.
+ *
+ * Every game starts from a random opening of a few plies that does not decide the game; after that both
+ * sides are played by the same engine configuration (written as in 'Tools/tournament.c', for example
+ * 'minimax:n2000'), through the engines' 'search' function. With -e, a move is replaced by a random move
+ * with the given probability in percent, so the games do not all follow the few lines the engine
+ * prefers. When a game ends, its quiet positions are labelled with the result and recorded: a position
+ * is quiet if the game is undecided and neither side can complete a line with one move, as the static
+ * evaluation is only used in such positions. The positions reached by the opening are not recorded.
+ *
+ * The games are spread over forked worker processes that send the records of a whole game with a single
+ * write to a shared pipe, which is atomic for writes of less than 'PIPE_BUF' bytes. The dataset format
+ * is described in 'Tools/dataset.h'.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/selfPlay.c Core/Src/engine.c Core/Src/tableEngine.c Core/Src/moveTable3x3.c \
+ *       Core/Src/minimax.c Core/Src/proofNumber.c Core/Src/evaluation.c Core/Src/evalTables.c \
+ *       Core/Src/winChecks.c -o selfPlay
+ *
+ * Usage:
+ *   ./selfPlay [-s size] [-g games] [-j jobs] [-p plies] [-e percent] [-r seed] [-o file] [config]
+ */
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "gameConfiguration.h"
+#include "engine.h"
+#include "evaluation.h"
+#include "winChecks.h"
+#include "dataset.h"
+
+#define maxJobs 64 /**< Largest supported number of worker processes */
+#define maxGameRecords (maxFieldSize * maxFieldSize) /**< Largest number of records of one game */
+
+_Static_assert(maxGameRecords * datasetRecordSize <= PIPE_BUF, "the records of a game must fit one atomic write");
+
+/**
+ * @brief Settings shared by all workers.
+ */
+typedef struct {
+	const Engine *engine;
+	EngineBudget budget;
+	int size;
+	long games;
+	int plies; /**< Number of random plies of the openings */
+	uint32_t randomPercent; /**< Probability of a random move after the opening, in percent */
+	uint32_t seed;
+} SelfPlaySettings;
+
+/**
+ * @brief Parses a configuration such as 'minimax:d4:n2000'.
+ *
+ * @param text The configuration.
+ * @param engine Receives the engine.
+ * @param budget Receives the search budget.
+ * @return True if the engine exists and the budget fields are valid, false otherwise.
+ */
+static bool parseConfiguration(const char *text, const Engine **engine, EngineBudget *budget) {
+	char name[32];
+	size_t length = strcspn(text, ":");
+	if (length >= sizeof(name))
+		return false;
+	memcpy(name, text, length);
+	name[length] = '\0';
+
+	*engine = EngineFind(name);
+	*budget = (EngineBudget) { 0 };
+	if (*engine == NULL)
+		return false;
+
+	for (const char *field = text + length; *field == ':'; field += 1 + strcspn(field + 1, ":")) {
+		char *end;
+		long value = strtol(field + 2, &end, 10);
+		if (value <= 0 || (*end != ':' && *end != '\0'))
+			return false;
+		if (field[1] == 'd')
+			budget->maxDepth = value;
+		else if (field[1] == 'n')
+			budget->maxNodes = value;
+		else
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Returns the next number of a xorshift sequence.
+ *
+ * @param state The state of the sequence, never 0.
+ * @return The next number.
+ */
+static uint32_t nextRandom(uint32_t *state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+/**
+ * @brief Places a piece on a random empty cell.
+ *
+ * @param board The game board, with at least one empty cell.
+ * @param size The size of the game board.
+ * @param player The character of the player to move.
+ * @param random The state of the random sequence.
+ */
+static void playRandom(char board[maxFieldSize][maxFieldSize], int size, char player, uint32_t *random) {
+	int cell;
+	do
+		cell = nextRandom(random) % (size * size);
+	while (board[cell / size][cell % size] != '\0');
+	board[cell / size][cell % size] = player;
+}
+
+/**
+ * @brief Lets the engine make the move of a player.
+ *
+ * @param settings The settings.
+ * @param board The current game board.
+ * @param player The character of the player to move.
+ * @return True if a move was made, false if the engine found no move.
+ */
+static bool playEngine(const SelfPlaySettings *settings, char board[maxFieldSize][maxFieldSize], char player) {
+	char view[maxFieldSize][maxFieldSize];
+	for (int i = 0; i < maxFieldSize; i++) {
+		for (int j = 0; j < maxFieldSize; j++) {
+			char cell = board[i][j];
+			if (player == firstPlayerChar && cell != '\0')
+				cell = cell == firstPlayerChar ? secondPlayerChar : firstPlayerChar;
+			view[i][j] = cell;
+		}
+	}
+
+	int row, column;
+	if (!settings->engine->search(view, settings->size, &settings->budget, &row, &column)
+			|| board[row][column] != '\0')
+		return false;
+	board[row][column] = player;
+	return true;
+}
+
+/**
+ * @brief Returns true if a position is undecided and neither side can complete a line with one move.
+ *
+ * @param board The game board.
+ * @param size The size of the game board.
+ * @return True if the position is quiet.
+ */
+static bool isQuiet(char board[maxFieldSize][maxFieldSize], int size) {
+	int threatCells[2];
+	return checkWin(board, size) == '\0' && FindThreats(board, size, secondPlayerChar, threatCells) == 0
+			&& FindThreats(board, size, firstPlayerChar, threatCells) == 0;
+}
+
+/**
+ * @brief Stores the bitboards of a position in a record.
+ *
+ * @param board The game board.
+ * @param size The size of the game board.
+ * @param record Receives the bitboards.
+ */
+static void storeBoard(char board[maxFieldSize][maxFieldSize], int size, DatasetRecord *record) {
+	record->computer = record->player = 0;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			record->computer |= (uint32_t) (board[i][j] == secondPlayerChar) << (i * maxFieldSize + j);
+			record->player |= (uint32_t) (board[i][j] == firstPlayerChar) << (i * maxFieldSize + j);
+		}
+	}
+}
+
+/**
+ * @brief Plays one game and sends its quiet positions, labelled with the result.
+ *
+ * @param settings The settings.
+ * @param game The index of the game, which selects its random sequence.
+ * @param output The pipe receiving the records.
+ * @return The number of records sent, or -1 if the pipe failed.
+ */
+static int playGame(const SelfPlaySettings *settings, long game, int output) {
+	int size = settings->size;
+	uint32_t random = settings->seed * 2654435761u + (uint32_t) game * 40503u + 1;
+	char board[maxFieldSize][maxFieldSize];
+	DatasetRecord records[maxGameRecords];
+	int count = 0, ply;
+
+	do {
+		memset(board, 0, sizeof(board));
+		for (ply = 0; ply < settings->plies; ply++)
+			playRandom(board, size, ply % 2 ? secondPlayerChar : firstPlayerChar, &random);
+	} while (checkWin(board, size) != '\0');
+	if (settings->engine->newGame != NULL)
+		settings->engine->newGame(size);
+
+	char status;
+	for (; (status = checkWin(board, size)) == '\0'; ply++) {
+		if (isQuiet(board, size)) {
+			storeBoard(board, size, &records[count]);
+			records[count++].ply = ply;
+		}
+		char player = ply % 2 ? secondPlayerChar : firstPlayerChar;
+		if (nextRandom(&random) % 100 < settings->randomPercent || !playEngine(settings, board, player))
+			playRandom(board, size, player, &random);
+	}
+
+	uint8_t result = status == firstPlayerChar ? playerWon : status == secondPlayerChar ? computerWon : gameDrawn;
+	uint8_t bytes[maxGameRecords * datasetRecordSize];
+	for (int r = 0; r < count; r++) {
+		records[r].size = size;
+		records[r].result = result;
+		datasetEncode(&records[r], bytes + r * datasetRecordSize);
+	}
+	if (count > 0 && write(output, bytes, count * datasetRecordSize) != (ssize_t) (count * datasetRecordSize))
+		return -1;
+	return count;
+}
+
+int main(int argc, char **argv) {
+	SelfPlaySettings settings = { .size = 4, .games = 2000, .plies = 2, .randomPercent = 10, .seed = 1 };
+	int jobs = (int) sysconf(_SC_NPROCESSORS_ONLN), option;
+	const char *path = "selfplay.bin";
+	while ((option = getopt(argc, argv, "s:g:j:p:e:r:o:")) != -1) {
+		switch (option) {
+		case 's':
+			settings.size = atoi(optarg);
+			break;
+		case 'g':
+			settings.games = atol(optarg);
+			break;
+		case 'j':
+			jobs = atoi(optarg);
+			break;
+		case 'p':
+			settings.plies = atoi(optarg);
+			break;
+		case 'e':
+			settings.randomPercent = strtoul(optarg, NULL, 10);
+			break;
+		case 'r':
+			settings.seed = strtoul(optarg, NULL, 10);
+			break;
+		case 'o':
+			path = optarg;
+			break;
+		default:
+			return 2;
+		}
+	}
+	jobs = jobs < 1 ? 1 : (jobs > maxJobs ? maxJobs : jobs);
+
+	const char *configuration = optind < argc ? argv[optind] : "minimax:n2000";
+	if (argc - optind > 1 || settings.size < 3 || settings.size > maxFieldSize || settings.games < 1
+			|| settings.plies < 0 || settings.plies >= settings.size * settings.size || settings.randomPercent > 100) {
+		fprintf(stderr, "usage: %s [-s size] [-g games] [-j jobs] [-p plies] [-e percent] [-r seed] [-o file] [config]\n",
+				argv[0]);
+		return 2;
+	}
+	if (!parseConfiguration(configuration, &settings.engine, &settings.budget)
+			|| (settings.engine->sizes & engineSize(settings.size)) == 0) {
+		fprintf(stderr, "invalid configuration for %dx%d: %s\n", settings.size, settings.size, configuration);
+		return 2;
+	}
+
+	FILE *file = fopen(path, "wb");
+	if (file == NULL || !datasetWriteHeader(file, 0)) {
+		perror(path);
+		return 1;
+	}
+
+	int records[2];
+	if (pipe(records) != 0) {
+		perror("pipe");
+		return 1;
+	}
+	for (int job = 0; job < jobs; job++) {
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("fork");
+			return 1;
+		}
+		if (pid == 0) {
+			close(records[0]);
+			if (settings.engine->init != NULL)
+				settings.engine->init();
+			for (long game = job; game < settings.games; game += jobs) {
+				if (playGame(&settings, game, records[1]) < 0)
+					_exit(1);
+			}
+			_exit(0);
+		}
+	}
+	close(records[1]);
+
+	uint8_t bytes[maxGameRecords * datasetRecordSize];
+	uint32_t count = 0;
+	size_t buffered = 0;
+	ssize_t received;
+	while ((received = read(records[0], bytes + buffered, sizeof(bytes) - buffered)) > 0) {
+		buffered += received;
+		size_t complete = buffered - buffered % datasetRecordSize;
+		if (fwrite(bytes, 1, complete, file) != complete) {
+			perror(path);
+			return 1;
+		}
+		count += complete / datasetRecordSize;
+		memmove(bytes, bytes + complete, buffered - complete);
+		buffered -= complete;
+	}
+	close(records[0]);
+
+	int failures = 0, status;
+	while (wait(&status) > 0)
+		failures += !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+	if (fseek(file, 0, SEEK_SET) != 0 || !datasetWriteHeader(file, count) || fclose(file) != 0) {
+		perror(path);
+		return 1;
+	}
+
+	printf("%dx%d, %ld games of %s from %d-ply openings, %u%% random moves, %d jobs: %u positions in %s\n",
+			settings.size, settings.size, settings.games, configuration, settings.plies, settings.randomPercent, jobs,
+			count, path);
+	if (failures > 0) {
+		fprintf(stderr, "%d jobs failed\n", failures);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,416 @@
+/**
+ * @file texelTune.c
+ * @brief Host tool tuning the weights of the horizon evaluation from self-play data and writing 'evalWeights.h'.
+ *
+ * The tool reads datasets written by 'Tools/selfPlay.c' and fits the weights with the Texel method: the
+ * evaluation of every position is mapped to an expected result by the logistic function
+ * 1 / (1 + exp(-K * evaluation)), and the weights are chosen to minimise the mean squared difference from
+ * the actual results (1 for a computer win, 0.5 for a draw, 0 for a player win). K is first fitted to the
+ * current weights and then kept fixed, so the tuned weights stay on the scale of the search's scores.
+ *
+ * The evaluation is linear in the weights: it is the sum over count of weight[count] times the number of
+ * windows holding 'count' computer pieces and no player piece, minus the same for the player. The tool
+ * counts these windows once per position with the windows of 'evalModes', then minimises the error by
+ * gradient descent (Adam). Quiet positions hold no window one piece short of a line, so the weight of
+ * such windows is not tuned. Every line length ('toWin') has its own weights; board sizes with the same
+ * line length share them, as they share the score table. Weights are kept between 0 and a bound that keeps every evaluation well below the
+ * search's win score, and are rounded to integers when written. With '-g', a line length whose rounded
+ * weights lower its mean squared error by less than the given gain keeps its current weights, so that a
+ * run on a small dataset does not replace them with noise; the generated header records the threshold.
+ *
+ * After tuning, regenerate the tables and check the strength before committing the weights:
+ *   ./genEvalTables > Core/Src/evalTables.c
+ *   ./tournament -s 5 minimax:n2000 <previous build's configuration>
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/texelTune.c Core/Src/evalTables.c -lm -o texelTune
+ *
+ * Usage:
+ *   ./texelTune [-i iterations] [-l rate] [-g gain] [-o header] dataset...
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "gameConfiguration.h"
+#include "evaluation.h"
+#include "evalWeights.h"
+#include "dataset.h"
+
+#define maxEvaluation 500 /**< Largest evaluation the weights may produce, half the search's win score */
+
+/**
+ * @brief The weights before tuning, index [toWin][count].
+ */
+static const int currentWeights[maxFieldSize + 1][maxFieldSize + 1] = LINE_WEIGHTS;
+
+/**
+ * @brief The positions of one line length, with their window counts.
+ *
+ * 'features[p * maxFieldSize + count]' is the number of windows of position p holding 'count' computer
+ * pieces and no player piece, minus the number holding 'count' player pieces and no computer piece.
+ */
+typedef struct {
+	int toWin;
+	size_t count;
+	size_t capacity;
+	int8_t *features;
+	float *results; /**< Actual results, from the computer's point of view */
+	double weights[maxFieldSize + 1]; /**< The weights being tuned */
+	double maxWeight; /**< Largest weight that keeps every evaluation below 'maxEvaluation' */
+	bool isKept; /**< True if the tuned weights gained too little and the current ones are kept */
+} TuningSet;
+
+static TuningSet sets[maxFieldSize + 1]; /**< Positions per line length, indexed by 'toWin' */
+
+/**
+ * @brief Adds a position to the set of its line length.
+ *
+ * @param record The position.
+ * @return True on success, false if the record is invalid or the memory cannot be allocated.
+ */
+static bool addPosition(const DatasetRecord *record) {
+	if (record->size < 3 || record->size > maxFieldSize || record->result > computerWon
+			|| (record->computer & record->player) != 0)
+		return false;
+	const EvalMode *mode = &evalModes[record->size - 3];
+	TuningSet *set = &sets[mode->toWin];
+	if (set->count == set->capacity) {
+		size_t capacity = set->capacity ? 2 * set->capacity : 4096;
+		int8_t *features = realloc(set->features, capacity * maxFieldSize);
+		if (features == NULL)
+			return false;
+		set->features = features;
+		float *results = realloc(set->results, capacity * sizeof(float));
+		if (results == NULL)
+			return false;
+		set->results = results;
+		set->capacity = capacity;
+	}
+
+	int8_t *features = &set->features[set->count * maxFieldSize];
+	memset(features, 0, maxFieldSize);
+	const uint8_t *window = mode->windowCells;
+	for (int w = 0; w < mode->windowCount; w++, window += mode->toWin) {
+		int computer = 0, player = 0;
+		for (int k = 0; k < mode->toWin; k++) {
+			computer += (record->computer >> window[k]) & 1;
+			player += (record->player >> window[k]) & 1;
+		}
+		if (player == 0)
+			features[computer]++;
+		else if (computer == 0)
+			features[player]--;
+	}
+	features[0] = 0;
+	set->results[set->count++] = record->result / 2.0f;
+
+	double maxWeight = (double) maxEvaluation / mode->windowCount;
+	set->toWin = mode->toWin;
+	set->maxWeight = set->maxWeight == 0 || maxWeight < set->maxWeight ? maxWeight : set->maxWeight;
+	return true;
+}
+
+/**
+ * @brief Reads all positions of a dataset.
+ *
+ * @param path The path of the dataset.
+ * @return The number of positions read, or -1 on error.
+ */
+static long readDataset(const char *path) {
+	FILE *file = fopen(path, "rb");
+	uint32_t count;
+	if (file == NULL || !datasetReadHeader(file, &count)) {
+		fprintf(stderr, "%s: not a dataset\n", path);
+		if (file != NULL)
+			fclose(file);
+		return -1;
+	}
+
+	for (uint32_t r = 0; r < count; r++) {
+		uint8_t bytes[datasetRecordSize];
+		DatasetRecord record;
+		if (fread(bytes, sizeof(bytes), 1, file) != 1) {
+			fprintf(stderr, "%s: truncated after %u of %u positions\n", path, r, count);
+			fclose(file);
+			return -1;
+		}
+		datasetDecode(bytes, &record);
+		if (!addPosition(&record)) {
+			fprintf(stderr, "%s: invalid position %u\n", path, r);
+			fclose(file);
+			return -1;
+		}
+	}
+	fclose(file);
+	return count;
+}
+
+/**
+ * @brief Returns the evaluation of a position with the weights of its set.
+ *
+ * @param set The set of the position.
+ * @param weights The weights.
+ * @param p The index of the position.
+ */
+static inline double evaluate(const TuningSet *set, const double weights[], size_t p) {
+	const int8_t *features = &set->features[p * maxFieldSize];
+	double evaluation = 0;
+	for (int count = 1; count < set->toWin; count++)
+		evaluation += weights[count] * features[count];
+	return evaluation;
+}
+
+/**
+ * @brief Returns the expected result of an evaluation.
+ */
+static inline double sigmoid(double k, double evaluation) {
+	return 1 / (1 + exp(-k * evaluation));
+}
+
+/**
+ * @brief Returns the summed squared error of all positions of a set.
+ *
+ * @param set The set.
+ * @param weights The weights.
+ * @param k The scaling constant of the logistic function.
+ */
+static double setError(const TuningSet *set, const double weights[], double k) {
+	double error = 0;
+	for (size_t p = 0; p < set->count; p++) {
+		double difference = set->results[p] - sigmoid(k, evaluate(set, weights, p));
+		error += difference * difference;
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the mean squared error of all positions with the given weights.
+ *
+ * @param isRounded True to round the weights to integers first, as they are written.
+ * @param isCurrent True to use the weights before tuning instead of the tuned ones.
+ * @param k The scaling constant of the logistic function.
+ */
+static double totalError(bool isRounded, bool isCurrent, double k) {
+	double error = 0;
+	size_t count = 0;
+	for (int toWin = 3; toWin <= maxFieldSize; toWin++) {
+		double weights[maxFieldSize + 1];
+		for (int c = 0; c <= maxFieldSize; c++) {
+			weights[c] = isCurrent ? currentWeights[toWin][c] : sets[toWin].weights[c];
+			weights[c] = isRounded ? round(weights[c]) : weights[c];
+		}
+		error += setError(&sets[toWin], weights, k);
+		count += sets[toWin].count;
+	}
+	return error / count;
+}
+
+/**
+ * @brief Finds the scaling constant that fits the current weights best, by golden-section search.
+ *
+ * @return The scaling constant.
+ */
+static double fitScale(void) {
+	const double ratio = (sqrt(5) - 1) / 2;
+	double low = 0.001, high = 2;
+	while (high - low > 1e-6) {
+		double left = high - ratio * (high - low), right = low + ratio * (high - low);
+		if (totalError(false, true, left) < totalError(false, true, right))
+			high = right;
+		else
+			low = left;
+	}
+	return (low + high) / 2;
+}
+
+/**
+ * @brief Tunes the weights of a set by gradient descent with Adam.
+ *
+ * Weights of window counts that no position holds keep their current value. This includes 'toWin - 1',
+ * as a window one piece short of a line is a threat and the positions are quiet.
+ *
+ * @param set The set; its weights start from the current ones and receive the tuned ones.
+ * @param k The scaling constant of the logistic function.
+ * @param iterations The number of passes over the set.
+ * @param rate The step size, in weight units.
+ */
+static void tune(TuningSet *set, double k, int iterations, double rate) {
+	const double beta1 = 0.9, beta2 = 0.999, epsilon = 1e-8;
+	double m[maxFieldSize + 1] = { 0 }, v[maxFieldSize + 1] = { 0 };
+	bool isPresent[maxFieldSize + 1] = { false };
+	for (size_t p = 0; p < set->count; p++) {
+		for (int count = 1; count < set->toWin; count++)
+			isPresent[count] |= set->features[p * maxFieldSize + count] != 0;
+	}
+
+	for (int iteration = 1; iteration <= iterations; iteration++) {
+		double gradient[maxFieldSize + 1] = { 0 };
+		for (size_t p = 0; p < set->count; p++) {
+			const int8_t *features = &set->features[p * maxFieldSize];
+			double expected = sigmoid(k, evaluate(set, set->weights, p));
+			double factor = (expected - set->results[p]) * expected * (1 - expected) * k;
+			for (int count = 1; count < set->toWin; count++)
+				gradient[count] += factor * features[count];
+		}
+		for (int count = 1; count < set->toWin; count++) {
+			if (!isPresent[count])
+				continue;
+			double g = 2 * gradient[count] / set->count;
+			m[count] = beta1 * m[count] + (1 - beta1) * g;
+			v[count] = beta2 * v[count] + (1 - beta2) * g * g;
+			double mHat = m[count] / (1 - pow(beta1, iteration));
+			double vHat = v[count] / (1 - pow(beta2, iteration));
+			double weight = set->weights[count] - rate * mHat / (sqrt(vHat) + epsilon);
+			set->weights[count] = weight < 0 ? 0 : (weight > set->maxWeight ? set->maxWeight : weight);
+		}
+	}
+}
+
+/**
+ * @brief Returns the mean squared error of a set with its weights rounded to integers.
+ *
+ * @param set The set.
+ * @param weights The weights.
+ * @param k The scaling constant of the logistic function.
+ */
+static double roundedSetError(const TuningSet *set, const double weights[], double k) {
+	double rounded[maxFieldSize + 1];
+	for (int c = 0; c <= maxFieldSize; c++)
+		rounded[c] = round(weights[c]);
+	return setError(set, rounded, k) / set->count;
+}
+
+/**
+ * @brief Writes the tuned weights as 'evalWeights.h'.
+ *
+ * Line lengths without positions, or whose tuned weights were not kept, keep their current weights.
+ *
+ * @param path The path of the header.
+ * @param minGain The minimum error gain the weights were tuned with.
+ * @return True on success.
+ */
+static bool writeHeader(const char *path, double minGain) {
+	FILE *file = fopen(path, "w");
+	if (file == NULL)
+		return false;
+
+	fprintf(file, "/**\n");
+	fprintf(file, " * @file evalWeights.h\n");
+	fprintf(file, " * @brief Weights of the horizon evaluation, read by 'Tools/genEvalTables.c'.\n");
+	fprintf(file, " *\n");
+	fprintf(file, " * This file is generated by Tools/texelTune.c from self-play data. Do not edit it by hand; to change\n");
+	fprintf(file, " * the weights, tune them again and regenerate 'Core/Src/evalTables.c' with 'Tools/genEvalTables.c'.\n");
+	if (minGain > 0) {
+		fprintf(file, " *\n");
+		fprintf(file, " * Tuned with '-g %g': line lengths whose tuned weights lowered the mean squared error by less\n", minGain);
+		fprintf(file, " * than %g kept their previous weights.\n", minGain);
+	}
+	fprintf(file, " */\n");
+	fprintf(file, "#pragma once\n");
+	fprintf(file, "#ifndef SRC_EVALWEIGHTS_H_\n");
+	fprintf(file, "#define SRC_EVALWEIGHTS_H_\n\n");
+	fprintf(file, "/**\n");
+	fprintf(file, " * @brief Score of a window holding 'count' pieces of only one player, indexed [toWin][count].\n");
+	fprintf(file, " *\n");
+	fprintf(file, " * A full window is a finished game and is never evaluated, so its weight is unused.\n");
+	fprintf(file, " */\n");
+	fprintf(file, "#define LINE_WEIGHTS { \\\n");
+	for (int toWin = 3; toWin <= maxFieldSize; toWin++) {
+		bool isUsed = false;
+		for (int c = 0; c <= maxFieldSize; c++)
+			isUsed |= currentWeights[toWin][c] != 0 || sets[toWin].count > 0;
+		if (!isUsed)
+			continue;
+		fprintf(file, "\t[%d] = {", toWin);
+		for (int c = 0; c <= toWin; c++) {
+			long weight = sets[toWin].count > 0 && !sets[toWin].isKept && c > 0 && c < toWin ?
+					lround(sets[toWin].weights[c]) : currentWeights[toWin][c];
+			fprintf(file, " %ld%s", weight, c < toWin ? "," : "");
+		}
+		fprintf(file, " }, \\\n");
+	}
+	fprintf(file, "}\n\n");
+	fprintf(file, "#endif /* SRC_EVALWEIGHTS_H_ */\n");
+
+	return fclose(file) == 0;
+}
+
+int main(int argc, char **argv) {
+	int iterations = 2000, option;
+	double rate = 0.05, minGain = 0;
+	const char *path = "Core/Inc/evalWeights.h";
+	while ((option = getopt(argc, argv, "i:l:g:o:")) != -1) {
+		switch (option) {
+		case 'i':
+			iterations = atoi(optarg);
+			break;
+		case 'l':
+			rate = atof(optarg);
+			break;
+		case 'g':
+			minGain = atof(optarg);
+			break;
+		case 'o':
+			path = optarg;
+			break;
+		default:
+			return 2;
+		}
+	}
+	if (optind >= argc || iterations < 1 || rate <= 0 || minGain < 0) {
+		fprintf(stderr, "usage: %s [-i iterations] [-l rate] [-g gain] [-o header] dataset...\n", argv[0]);
+		return 2;
+	}
+
+	long positions = 0;
+	for (int a = optind; a < argc; a++) {
+		long count = readDataset(argv[a]);
+		if (count < 0)
+			return 1;
+		positions += count;
+	}
+	if (positions == 0) {
+		fprintf(stderr, "no positions\n");
+		return 1;
+	}
+
+	for (int toWin = 3; toWin <= maxFieldSize; toWin++) {
+		for (int c = 0; c <= maxFieldSize; c++)
+			sets[toWin].weights[c] = currentWeights[toWin][c];
+	}
+	double k = fitScale();
+	printf("%ld positions, K = %.5f, error %.6f with the current weights\n", positions, k, totalError(false, true, k));
+
+	for (int toWin = 3; toWin <= maxFieldSize; toWin++) {
+		TuningSet *set = &sets[toWin];
+		if (set->count == 0)
+			continue;
+		double current[maxFieldSize + 1];
+		for (int c = 0; c <= maxFieldSize; c++)
+			current[c] = currentWeights[toWin][c];
+		tune(set, k, iterations, rate);
+		double gain = roundedSetError(set, current, k) - roundedSetError(set, set->weights, k);
+		printf("toWin %d, %zu positions:", toWin, set->count);
+		for (int c = 1; c < toWin; c++)
+			printf(" %d -> %.2f", currentWeights[toWin][c], set->weights[c]);
+		printf(", gain %.6f", gain);
+		if (gain < minGain) {
+			memcpy(set->weights, current, sizeof(current));
+			set->isKept = true;
+			printf(", kept");
+		}
+		printf("\n");
+	}
+	printf("error %.6f tuned, %.6f rounded\n", totalError(false, false, k), totalError(true, false, k));
+
+	if (!writeHeader(path, minGain)) {
+		perror(path);
+		return 1;
+	}
+	printf("wrote %s\n", path);
+	return 0;
+}
@@ -0,0 +1,376 @@
+/**
+ * @file tournament.c
+ * @brief Host tool playing engine configurations against each other and reporting the Elo difference.
+ *
+ * A configuration is a registered engine with a search budget, written as the engine name followed by
+ * optional budget fields: 'minimax:d4' searches to depth 4, 'minimax:n2000' stops after 2000 nodes,
+ * 'minimax' and 'table' use the defaults. The moves are chosen through the engines' 'search' function,
+ * the same code path 'EngineMove()' and 'ComputerMove()' use in the firmware. An engine that plays the
+ * first player ('x') sees the board with the pieces swapped, as the engines always move as 'o'.
+ *
+ * Every game starts from a random opening of a few plies that does not decide the game, and each opening
+ * is played twice, once with each configuration moving first. The openings depend only on the seed and
+ * the index of the pair, so results do not depend on the number of jobs. The games are spread over
+ * forked worker processes. The engines have no time budget, so equal budgets are node budgets; the
+ * average time per move of each configuration is reported to compare strength at equal time.
+ *
+ * The Elo difference is derived from the score of the first configuration, with a 95% confidence interval
+ * from the standard error of the per-game scores.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/tournament.c Core/Src/engine.c Core/Src/tableEngine.c Core/Src/moveTable3x3.c \
+ *       Core/Src/minimax.c Core/Src/proofNumber.c Core/Src/evaluation.c Core/Src/evalTables.c \
+ *       Core/Src/winChecks.c -lm -o tournament
+ *
+ * To compare compile-time settings such as the constants of 'minimax.h', a second build of the Minimax
+ * engine can play as 'minimax2': compile a copy of 'minimax.c' with the other settings, keep only its
+ * engine global under a new name, and link it into a tournament built with TOURNAMENT_SECOND_MINIMAX:
+ *   gcc -c -O2 -ICore/Inc -DLATE_MOVE_REDUCTION=0 Core/Src/minimax.c -o minimax2.o
+ *   objcopy --keep-global-symbol=minimaxEngine2 --redefine-sym minimaxEngine=minimaxEngine2 minimax2.o
+ *   gcc -O2 -ICore/Inc -DTOURNAMENT_SECOND_MINIMAX Tools/tournament.c minimax2.o <the sources above> \
+ *       -lm -o tournament
+ *   ./tournament -s 5 minimax minimax2
+ *
+ * Usage:
+ *   ./tournament [-s size] [-g pairs] [-j jobs] [-p plies] [-r seed] configA configB
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "gameConfiguration.h"
+#include "engine.h"
+#include "winChecks.h"
+
+#define maxJobs 64 /**< Largest supported number of worker processes */
+
+#ifdef TOURNAMENT_SECOND_MINIMAX
+extern const Engine minimaxEngine2; /**< The Minimax engine of a second build, see the file comment */
+#endif
+
+/**
+ * @brief An engine with a search budget.
+ */
+typedef struct {
+	const char *text; /**< The configuration as given on the command line */
+	const Engine *engine;
+	EngineBudget budget;
+} Configuration;
+
+/**
+ * @brief Results of a worker, from the point of view of the first configuration.
+ */
+typedef struct {
+	long wins, draws, losses;
+	unsigned long moves[2]; /**< Number of moves of each configuration */
+	unsigned long nodes[2]; /**< Search nodes of each configuration */
+	double seconds[2]; /**< Thinking time of each configuration */
+} Results;
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Parses a configuration such as 'minimax:d4:n2000'.
+ *
+ * @param text The configuration.
+ * @param configuration Receives the configuration.
+ * @return True if the engine exists and the budget fields are valid, false otherwise.
+ */
+static bool parseConfiguration(const char *text, Configuration *configuration) {
+	char name[32];
+	size_t length = strcspn(text, ":");
+	if (length >= sizeof(name))
+		return false;
+	memcpy(name, text, length);
+	name[length] = '\0';
+
+	configuration->text = text;
+	configuration->engine = EngineFind(name);
+#ifdef TOURNAMENT_SECOND_MINIMAX
+	if (strcmp(name, "minimax2") == 0)
+		configuration->engine = &minimaxEngine2;
+#endif
+	configuration->budget = (EngineBudget) { 0 };
+	if (configuration->engine == NULL)
+		return false;
+
+	for (const char *field = text + length; *field == ':'; field += 1 + strcspn(field + 1, ":")) {
+		char *end;
+		long value = strtol(field + 2, &end, 10);
+		if (value <= 0 || (*end != ':' && *end != '\0'))
+			return false;
+		if (field[1] == 'd')
+			configuration->budget.maxDepth = value;
+		else if (field[1] == 'n')
+			configuration->budget.maxNodes = value;
+		else
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Returns the next number of a xorshift sequence.
+ *
+ * @param state The state of the sequence, never 0.
+ * @return The next number.
+ */
+static uint32_t nextRandom(uint32_t *state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+/**
+ * @brief Plays the random opening of a pair of games.
+ *
+ * @param board Receives the opening position, with the first player ('x') to move after an even number of plies.
+ * @param size The size of the game board.
+ * @param plies The number of random plies.
+ * @param seed The seed of the tournament.
+ * @param pair The index of the pair of games.
+ */
+static void playOpening(char board[maxFieldSize][maxFieldSize], int size, int plies, uint32_t seed, long pair) {
+	uint32_t random = seed * 2654435761u + (uint32_t) pair * 40503u + 1;
+	do {
+		memset(board, 0, maxFieldSize * maxFieldSize);
+		for (int ply = 0; ply < plies;) {
+			int cell = nextRandom(&random) % (size * size);
+			if (board[cell / size][cell % size] != '\0')
+				continue;
+			board[cell / size][cell % size] = ply % 2 ? secondPlayerChar : firstPlayerChar;
+			ply++;
+		}
+	} while (checkWin(board, size) != '\0');
+}
+
+/**
+ * @brief Lets a configuration make its move.
+ *
+ * @param configuration The configuration.
+ * @param board The current game board.
+ * @param size The size of the game board.
+ * @param player The character of the player the configuration plays.
+ * @param results Receives the statistics of the move.
+ * @param side The index of the configuration in the statistics.
+ * @return True if a move was made, false if the engine found no move.
+ */
+static bool makeMove(const Configuration *configuration, char board[maxFieldSize][maxFieldSize], int size,
+		char player, Results *results, int side) {
+	char view[maxFieldSize][maxFieldSize];
+	for (int i = 0; i < maxFieldSize; i++) {
+		for (int j = 0; j < maxFieldSize; j++) {
+			char cell = board[i][j];
+			if (player == firstPlayerChar && cell != '\0')
+				cell = cell == firstPlayerChar ? secondPlayerChar : firstPlayerChar;
+			view[i][j] = cell;
+		}
+	}
+
+	int row, column;
+	EngineStats stats = { 0 };
+	double start = now();
+	bool isFound = configuration->engine->search(view, size, &configuration->budget, &row, &column);
+	results->seconds[side] += now() - start;
+	if (configuration->engine->stats != NULL)
+		configuration->engine->stats(&stats);
+	results->nodes[side] += stats.nodes;
+	results->moves[side]++;
+
+	if (!isFound || board[row][column] != '\0')
+		return false;
+	board[row][column] = player;
+	return true;
+}
+
+/**
+ * @brief Plays one game from an opening.
+ *
+ * @param configurations The two configurations.
+ * @param first The index of the configuration that plays the first player ('x').
+ * @param opening The opening position.
+ * @param size The size of the game board.
+ * @param plies The number of plies of the opening.
+ * @param results Receives the statistics of the moves.
+ * @return The score of the first configuration: 2 for a win, 1 for a draw, 0 for a loss.
+ */
+static int playGame(const Configuration configurations[2], int first, char opening[maxFieldSize][maxFieldSize],
+		int size, int plies, Results *results) {
+	char board[maxFieldSize][maxFieldSize];
+	memcpy(board, opening, sizeof(board));
+	for (int c = 0; c < 2; c++) {
+		if (configurations[c].engine->newGame != NULL)
+			configurations[c].engine->newGame(size);
+	}
+
+	char status;
+	for (int ply = plies; (status = checkWin(board, size)) == '\0'; ply++) {
+		char player = ply % 2 ? secondPlayerChar : firstPlayerChar;
+		int side = player == firstPlayerChar ? first : 1 - first;
+		if (!makeMove(&configurations[side], board, size, player, results, side))
+			return side == 0 ? 0 : 2;
+	}
+
+	if (status == 'd')
+		return 1;
+	char firstPlayer = first == 0 ? firstPlayerChar : secondPlayerChar;
+	return status == firstPlayer ? 2 : 0;
+}
+
+/**
+ * @brief Plays every pair of games whose index is congruent to the job modulo the number of jobs.
+ *
+ * @param configurations The two configurations.
+ * @param size The size of the game board.
+ * @param pairs The number of pairs of games.
+ * @param plies The number of plies of the openings.
+ * @param seed The seed of the tournament.
+ * @param job The index of the job.
+ * @param jobs The number of jobs.
+ * @param results Receives the results.
+ */
+static void playPairs(const Configuration configurations[2], int size, long pairs, int plies, uint32_t seed, int job,
+		int jobs, Results *results) {
+	for (int c = 0; c < 2; c++) {
+		if (configurations[c].engine->init != NULL)
+			configurations[c].engine->init();
+	}
+
+	for (long pair = job; pair < pairs; pair += jobs) {
+		char opening[maxFieldSize][maxFieldSize];
+		playOpening(opening, size, plies, seed, pair);
+		for (int first = 0; first < 2; first++) {
+			int score = playGame(configurations, first, opening, size, plies, results);
+			results->wins += score == 2;
+			results->draws += score == 1;
+			results->losses += score == 0;
+		}
+	}
+}
+
+/**
+ * @brief Converts a score fraction to an Elo difference.
+ *
+ * @param score The score fraction, from 0 to 1.
+ * @return The Elo difference, infinite for a score of 0 or 1.
+ */
+static double scoreToElo(double score) {
+	if (score <= 0)
+		return -INFINITY;
+	if (score >= 1)
+		return INFINITY;
+	return -400 * log10(1 / score - 1);
+}
+
+int main(int argc, char **argv) {
+	int size = 4, jobs = (int) sysconf(_SC_NPROCESSORS_ONLN), plies = 2, option;
+	long pairs = 500;
+	uint32_t seed = 1;
+	while ((option = getopt(argc, argv, "s:g:j:p:r:")) != -1) {
+		switch (option) {
+		case 's':
+			size = atoi(optarg);
+			break;
+		case 'g':
+			pairs = atol(optarg);
+			break;
+		case 'j':
+			jobs = atoi(optarg);
+			break;
+		case 'p':
+			plies = atoi(optarg);
+			break;
+		case 'r':
+			seed = strtoul(optarg, NULL, 10);
+			break;
+		default:
+			return 2;
+		}
+	}
+	jobs = jobs < 1 ? 1 : (jobs > maxJobs ? maxJobs : jobs);
+
+	Configuration configurations[2];
+	if (argc - optind != 2 || size < 3 || size > maxFieldSize || pairs < 1 || plies < 0 || plies >= size * size) {
+		fprintf(stderr, "usage: %s [-s size] [-g pairs] [-j jobs] [-p plies] [-r seed] configA configB\n", argv[0]);
+		return 2;
+	}
+	for (int c = 0; c < 2; c++) {
+		if (!parseConfiguration(argv[optind + c], &configurations[c])
+				|| (configurations[c].engine->sizes & engineSize(size)) == 0) {
+			fprintf(stderr, "invalid configuration for %dx%d: %s\n", size, size, argv[optind + c]);
+			return 2;
+		}
+	}
+
+	int pipes[maxJobs][2];
+	for (int job = 0; job < jobs; job++) {
+		if (pipe(pipes[job]) != 0) {
+			perror("pipe");
+			return 2;
+		}
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("fork");
+			return 2;
+		}
+		if (pid == 0) {
+			Results results = { 0 };
+			close(pipes[job][0]);
+			playPairs(configurations, size, pairs, plies, seed, job, jobs, &results);
+			ssize_t written = write(pipes[job][1], &results, sizeof(results));
+			_exit(written == (ssize_t) sizeof(results) ? 0 : 1);
+		}
+		close(pipes[job][1]);
+	}
+
+	Results total = { 0 };
+	for (int job = 0; job < jobs; job++) {
+		Results results;
+		if (read(pipes[job][0], &results, sizeof(results)) != (ssize_t) sizeof(results)) {
+			fprintf(stderr, "job %d failed\n", job);
+			return 1;
+		}
+		close(pipes[job][0]);
+		total.wins += results.wins;
+		total.draws += results.draws;
+		total.losses += results.losses;
+		for (int c = 0; c < 2; c++) {
+			total.moves[c] += results.moves[c];
+			total.nodes[c] += results.nodes[c];
+			total.seconds[c] += results.seconds[c];
+		}
+	}
+	while (wait(NULL) > 0)
+		;
+
+	long games = total.wins + total.draws + total.losses;
+	double score = (total.wins + 0.5 * total.draws) / games;
+	double variance = (total.wins * (1 - score) * (1 - score) + total.draws * (0.5 - score) * (0.5 - score)
+			+ total.losses * score * score) / games;
+	double margin = 1.96 * sqrt(variance / games);
+
+	printf("%dx%d, %ld games from %d-ply openings, %d jobs\n", size, size, games, plies, jobs);
+	for (int c = 0; c < 2; c++) {
+		unsigned long moves = total.moves[c] > 0 ? total.moves[c] : 1;
+		printf("  %-20s %10lu nodes/move %10.3f ms/move\n", configurations[c].text, total.nodes[c] / moves,
+				total.seconds[c] * 1e3 / moves);
+	}
+	printf("%s vs %s: +%ld =%ld -%ld, score %.1f%%, Elo %+.1f [%+.1f, %+.1f]\n", configurations[0].text,
+			configurations[1].text, total.wins, total.draws, total.losses, 100 * score, scoreToElo(score),
+			scoreToElo(score - margin), scoreToElo(score + margin));
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file winCheckBench.c
+ * @brief Host benchmark comparing the packed 'checkWin()' with the cell-by-cell 'checkWinScalar()'.
+ *
+ * For every board size, the benchmark fills a fixed set of random boards with 0 to size * size pieces,
+ * so the set contains open games, wins of both players and draws. It first verifies that both functions
+ * return the same result on every board, then times both over the set and reports the million checks
+ * per second and the speedup. On the host, 'checkWin()' uses the portable packed-byte compares; build
+ * with -DWIN_CHECK_BENCH_SEED=n to measure another set of boards.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ICore/Inc Tools/winCheckBench.c Core/Src/winChecks.c -o winCheckBench
+ *
+ * Usage:
+ *   ./winCheckBench [boards] [rounds]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gameConfiguration.h"
+#include "winChecks.h"
+
+#ifndef WIN_CHECK_BENCH_SEED
+#define WIN_CHECK_BENCH_SEED 1 /**< Seed of the random boards */
+#endif
+
+#define maxBoards 100000 /**< Largest supported number of boards per size */
+
+static char boards[maxBoards][maxFieldSize][maxFieldSize];
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Fills the boards with random pieces of both players, alternating like in a game.
+ *
+ * @param size The size of the game board.
+ * @param count The number of boards.
+ */
+static void generateBoards(int size, int count) {
+	for (int b = 0; b < count; b++) {
+		char (*board)[maxFieldSize] = boards[b];
+		memset(board, 0, maxFieldSize * maxFieldSize);
+		int pieces = rand() % (size * size + 1);
+		for (int k = 0; k < pieces;) {
+			int cell = rand() % (size * size);
+			if (board[cell / size][cell % size] != '\0')
+				continue;
+			board[cell / size][cell % size] = k % 2 ? secondPlayerChar : firstPlayerChar;
+			k++;
+		}
+	}
+}
+
+/**
+ * @brief Times a win check over all boards.
+ *
+ * @param check The win check.
+ * @param size The size of the game board.
+ * @param count The number of boards.
+ * @param rounds How often the boards are checked.
+ * @param sum Receives a sum of the results, so the checks cannot be optimised away.
+ * @return The elapsed time in seconds.
+ */
+static double timeCheck(char (*check)(char[maxFieldSize][maxFieldSize], int), int size, int count, int rounds,
+		unsigned long *sum) {
+	unsigned long total = 0;
+	double start = now();
+	for (int r = 0; r < rounds; r++) {
+		for (int b = 0; b < count; b++)
+			total += (unsigned char) check(boards[b], size);
+	}
+	double elapsed = now() - start;
+	*sum = total;
+	return elapsed;
+}
+
+int main(int argc, char **argv) {
+	int boardCount = argc > 1 ? atoi(argv[1]) : 10000;
+	int rounds = argc > 2 ? atoi(argv[2]) : 100;
+	if (boardCount < 1 || boardCount > maxBoards || rounds < 1) {
+		fprintf(stderr, "expected 1..%d boards and at least one round\n", maxBoards);
+		return 2;
+	}
+
+	srand(WIN_CHECK_BENCH_SEED);
+	printf("%-4s %8s %8s %8s %12s %12s %8s\n", "size", "wins", "draws", "open", "scalar M/s", "packed M/s",
+			"speedup");
+	for (int size = 3; size <= maxFieldSize; size++) {
+		generateBoards(size, boardCount);
+
+		int wins = 0, draws = 0, open = 0;
+		for (int b = 0; b < boardCount; b++) {
+			char expected = checkWinScalar(boards[b], size);
+			char result = checkWin(boards[b], size);
+			if (result != expected) {
+				fprintf(stderr, "%dx%d board %d: checkWin '%c', checkWinScalar '%c'\n", size, size, b,
+						result ? result : '-', expected ? expected : '-');
+				return 1;
+			}
+			wins += expected == firstPlayerChar || expected == secondPlayerChar;
+			draws += expected == 'd';
+			open += expected == '\0';
+		}
+
+		unsigned long scalarSum, packedSum;
+		double scalar = timeCheck(checkWinScalar, size, boardCount, rounds, &scalarSum);
+		double packed = timeCheck(checkWin, size, boardCount, rounds, &packedSum);
+		double checks = (double) boardCount * rounds;
+		printf("%dx%d  %8d %8d %8d %12.1f %12.1f %7.2fx\n", size, size, wins, draws, open, checks / scalar * 1e-6,
+				checks / packed * 1e-6, scalar / packed);
+		if (scalarSum != packedSum)
+			return 1;
+	}
+
+	return 0;
+}